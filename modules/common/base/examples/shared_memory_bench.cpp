@@ -4,10 +4,14 @@
 
 #include <array>
 #include <cstring>
+#include <numeric>
 #include <random>
+#include <span>
 #include <stdexcept>
+#include <vector>
 
 #include <benchmark/benchmark.h>
+#include <sys/resource.h>  // for getrusage
 
 #include "grape/shared_memory.h"
 
@@ -195,6 +199,166 @@ void bmShmCopy(benchmark::State& state) {
       static_cast<int64_t>(static_cast<std::size_t>(state.iterations()) * size));
 }
 
+//-------------------------------------------------------------------------------------------------
+// Placement of regions under test in bmShmFirstTouch, bmShmSequential and bmShmRandom
+enum class Placement : std::uint8_t {
+  Default,      //!< 4 KiB pages, faulted in on first touch
+  Populate,     //!< 4 KiB pages, pre-faulted on creation
+  Transparent,  //!< Transparent huge pages, pre-faulted on creation
+  HugeTlb,      //!< Explicit huge pages, pre-faulted on creation
+};
+
+//-------------------------------------------------------------------------------------------------
+auto optionsFor(Placement placement) -> ShMem::Options {
+  using HugePages = ShMem::Options::HugePages;
+  switch (placement) {
+    case Placement::Default:
+      return {};
+    case Placement::Populate:
+      return { .populate = true };
+    case Placement::Transparent:
+      return { .huge_pages = HugePages::Transparent, .populate = true };
+    case Placement::HugeTlb:
+      return { .huge_pages = HugePages::HugeTlb, .populate = true };
+  }
+  return {};
+}
+
+//-------------------------------------------------------------------------------------------------
+auto labelFor(Placement placement) -> std::string {
+  switch (placement) {
+    case Placement::Default:
+      return "default";
+    case Placement::Populate:
+      return "populate";
+    case Placement::Transparent:
+      return "thp";
+    case Placement::HugeTlb:
+      return "hugetlb";
+  }
+  return {};
+}
+
+//-------------------------------------------------------------------------------------------------
+// Page faults (minor and major) incurred by the calling thread so far
+auto pageFaults() -> std::int64_t {
+  auto usage = rusage{};
+  ::getrusage(RUSAGE_THREAD, &usage);
+  return usage.ru_minflt + usage.ru_majflt;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Creates a region and writes to every 4 KiB page of it once. Reports page faults taken on the
+// writes, which pre-faulting and huge pages are meant to eliminate or reduce
+void bmShmFirstTouch(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto placement = static_cast<Placement>(state.range(1));
+  static constexpr auto SMALL_PAGE_SIZE = 4096UZ;
+
+  auto faults = std::int64_t{ 0 };
+  for (auto st : state) {
+    (void)st;
+    const auto shm_name = createUniqueShmName();
+    const auto options = optionsFor(placement);
+    auto shm_result = ShMem::create(shm_name, size, ShMem::Access::ReadWrite, options);
+    if (not shm_result.has_value()) {
+      state.SkipWithError(std::string{ shm_result.error().message() }.c_str());
+      return;
+    }
+    auto data = shm_result.value().data();
+
+    const auto faults_start = pageFaults();
+    for (auto offset = 0UZ; offset < size; offset += SMALL_PAGE_SIZE) {
+      data[offset] = std::byte{ 1 };
+    }
+    benchmark::ClobberMemory();
+    faults += pageFaults() - faults_start;
+
+    shm_result.value().close();
+    std::ignore = ShMem::remove(shm_name);
+  }
+  state.counters["faults_on_touch"] =
+      benchmark::Counter(static_cast<double>(faults), benchmark::Counter::kAvgIterations);
+  state.SetLabel(labelFor(placement));
+}
+
+//-------------------------------------------------------------------------------------------------
+// Reads a (pre-faulted) region front to back
+void bmShmSequential(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto placement = static_cast<Placement>(state.range(1));
+  const auto shm_name = createUniqueShmName();
+  const auto options = optionsFor(placement);
+  auto shm_result = ShMem::create(shm_name, size, ShMem::Access::ReadWrite, options);
+  if (not shm_result.has_value()) {
+    state.SkipWithError(std::string{ shm_result.error().message() }.c_str());
+    return;
+  }
+  auto& shm = shm_result.value();
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  const auto* const first_word = reinterpret_cast<const std::uint64_t*>(shm.data().data());
+  const auto words = std::span{ first_word, size / sizeof(std::uint64_t) };
+
+  for (auto st : state) {
+    (void)st;
+    auto sum = std::accumulate(words.begin(), words.end(), std::uint64_t{ 0 });
+    benchmark::DoNotOptimize(sum);
+  }
+
+  shm.close();
+  std::ignore = ShMem::remove(shm_name);
+
+  state.SetBytesProcessed(
+      static_cast<int64_t>(static_cast<std::size_t>(state.iterations()) * size));
+  state.SetLabel(labelFor(placement));
+}
+
+//-------------------------------------------------------------------------------------------------
+// Reads one cache line at a time from random locations across a (pre-faulted) region. Dominated
+// by TLB misses for regions much larger than the TLB reach of 4 KiB pages
+void bmShmRandom(benchmark::State& state) {
+  const auto size = static_cast<std::size_t>(state.range(0));
+  const auto placement = static_cast<Placement>(state.range(1));
+  const auto shm_name = createUniqueShmName();
+  const auto options = optionsFor(placement);
+  auto shm_result = ShMem::create(shm_name, size, ShMem::Access::ReadWrite, options);
+  if (not shm_result.has_value()) {
+    state.SkipWithError(std::string{ shm_result.error().message() }.c_str());
+    return;
+  }
+  auto& shm = shm_result.value();
+  const auto data = shm.data();
+
+  static constexpr auto CACHE_LINE_SIZE = 64UZ;
+  static constexpr auto NUM_ACCESSES = 1UZ << 16U;
+  auto offsets = std::vector<std::size_t>(NUM_ACCESSES);
+  auto gen = std::mt19937_64{ std::random_device{}() };
+  auto dist = std::uniform_int_distribution<std::size_t>(0, (size / CACHE_LINE_SIZE) - 1U);
+  for (auto& offset : offsets) {
+    offset = dist(gen) * CACHE_LINE_SIZE;
+  }
+
+  for (auto st : state) {
+    (void)st;
+    auto sum = std::uint64_t{ 0 };
+    for (const auto offset : offsets) {
+      std::uint64_t word{};
+      std::memcpy(&word, data.subspan(offset).data(), sizeof(word));
+      sum += word;
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+
+  shm.close();
+  std::ignore = ShMem::remove(shm_name);
+
+  state.SetBytesProcessed(static_cast<int64_t>(static_cast<std::size_t>(state.iterations()) *
+                                               NUM_ACCESSES * CACHE_LINE_SIZE));
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                          static_cast<int64_t>(NUM_ACCESSES));
+  state.SetLabel(labelFor(placement));
+}
+
 constexpr auto MIN_ITERATIONS = 1000U;
 constexpr auto MAX_ITERATIONS = 10000U;
 
@@ -225,6 +389,18 @@ BENCHMARK(bmShmCopy)
     ->Arg(LARGE_SIZE)
     ->Iterations(MAX_ITERATIONS);
 
+constexpr auto HUGE_SIZE = 256U * LARGE_SIZE;  // 256MB
+const auto PLACEMENTS = std::vector<std::int64_t>{
+  static_cast<std::int64_t>(Placement::Default),
+  static_cast<std::int64_t>(Placement::Populate),
+  static_cast<std::int64_t>(Placement::Transparent),
+  static_cast<std::int64_t>(Placement::HugeTlb),
+};
+
+BENCHMARK(bmShmFirstTouch)->ArgsProduct({ { LARGE_SIZE, HUGE_SIZE }, PLACEMENTS })->UseRealTime();
+BENCHMARK(bmShmSequential)->ArgsProduct({ { LARGE_SIZE, HUGE_SIZE }, PLACEMENTS });
+BENCHMARK(bmShmRandom)->ArgsProduct({ { LARGE_SIZE, HUGE_SIZE }, PLACEMENTS });
+
 }  // namespace
 
 BENCHMARK_MAIN();
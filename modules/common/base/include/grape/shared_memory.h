@@ -7,19 +7,53 @@
 #include <cstddef>
 #include <cstdint>
 #include <expected>
+#include <optional>
 #include <span>
 #include <string>
+#include <string_view>
 
 #include "grape/error.h"
 
 namespace grape {
 
+//=================================================================================================
+/// Placement and residency options for a shared memory region. See SharedMemory::create()
+///
+struct SharedMemoryOptions {
+  /// Page size backing the region
+  enum class HugePages : std::uint8_t {
+    None,         //!< Regular (typically 4 KiB) pages
+    Transparent,  //!< Advise the kernel to back the region with transparent huge pages. Effective
+                  //!< only if /sys/kernel/mm/transparent_hugepage/shmem_enabled is 'advise'
+    HugeTlb,      //!< Explicit huge pages from a hugetlbfs mount (SharedMemory::HUGETLBFS_PATH).
+                  //!< Requires huge pages to be reserved (vm.nr_hugepages). Region size is rounded
+                  //!< up to a multiple of the huge page size
+  };
+
+  HugePages huge_pages{ HugePages::None };
+
+  /// Pre-fault all pages on creation so that first access does not incur page faults
+  bool populate{ false };
+
+  /// Lock pages in RAM (mlock) so that they are never paged out. Implies populate. Subject to
+  /// RLIMIT_MEMLOCK
+  bool lock{ false };
+
+  /// If set, bind memory for the region to this NUMA node
+  std::optional<std::uint32_t> numa_node{};
+};
+
 //=================================================================================================
 /// Creates or maps shared memory accessible across processes
 ///
 class SharedMemory {
 public:
   enum class Access : std::uint8_t { ReadOnly, ReadWrite };
+  using Options = SharedMemoryOptions;
+
+  /// Mount point of the hugetlbfs file system holding regions created with
+  /// Options::HugePages::HugeTlb. Such regions are found by name by open(), exists() and remove()
+  static constexpr auto HUGETLBFS_PATH = std::string_view{ "/dev/hugepages" };
 
   /// Checks for existence of a shared memory region.
   /// @param name Identifying name.
@@ -46,8 +80,10 @@ public:
   /// and not contain additional '/' characters.
   /// @param size The number of bytes to allocate in the shared region.
   /// @param access Requested access rights.
+  /// @param options Page size, pre-faulting and NUMA placement of the region.
   /// @return A memory segment mapped to process address space on success, else error.
-  [[nodiscard]] static auto create(const std::string& name, std::size_t size, Access access)
+  [[nodiscard]] static auto create(const std::string& name, std::size_t size, Access access,
+                                   const Options& options = {})
       -> std::expected<SharedMemory, Error>;
 
   /// Open a pre-existing shared memory region and map it to caller's process address space.
@@ -5,21 +5,100 @@
 #include "grape/shared_memory.h"
 
 #include <cerrno>
+#include <climits>  // for CHAR_BIT
+#include <format>
 #include <string_view>
 #include <system_error>
+#include <tuple>  // for ignore
 #include <utility>
 
-#include <fcntl.h>      // for O_RDONLY, O_RDWR, O_CREAT, O_EXCL
-#include <sys/mman.h>   // for PROT_READ, shm_open, MAP_FAILED, MAP_SHARED
-#include <sys/stat.h>   // for stat, fstat, S_IRGRP, S_IROTH, S_IRUSR, S_IWGRP
-#include <sys/types.h>  // for off_t
-#include <unistd.h>     // for close, ftruncate
+#include <fcntl.h>            // for O_RDONLY, O_RDWR, O_CREAT, O_EXCL
+#include <linux/magic.h>      // for HUGETLBFS_MAGIC
+#include <linux/mempolicy.h>  // for MPOL_BIND, MPOL_MF_STRICT
+#include <sys/mman.h>         // for PROT_READ, shm_open, MAP_FAILED, MAP_SHARED, madvise, mlock
+#include <sys/stat.h>         // for stat, fstat, S_IRGRP, S_IROTH, S_IRUSR, S_IWGRP
+#include <sys/statfs.h>       // for statfs, fstatfs
+#include <sys/syscall.h>      // for SYS_mbind
+#include <sys/types.h>        // for off_t
+#include <unistd.h>           // for close, ftruncate, syscall, unlink
+
+namespace {
+
+//-------------------------------------------------------------------------------------------------
+// Path of the file backing a region created with explicit huge pages
+auto hugeTlbPath(const std::string& name) -> std::string {
+  return std::format("{}{}", grape::SharedMemory::HUGETLBFS_PATH, name);
+}
+
+//-------------------------------------------------------------------------------------------------
+// Open a region by name, looking in the POSIX shared memory namespace first and hugetlbfs next
+auto openRegion(const std::string& name, int oflag) -> int {
+  static constexpr auto MODE = 0;  // unused
+  const auto fd = ::shm_open(name.c_str(), oflag, MODE);
+  if ((fd == -1) and (errno == ENOENT)) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    return ::open(hugeTlbPath(name).c_str(), oflag | O_CLOEXEC);
+  }
+  return fd;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Remove a region created by SharedMemory::create() from the namespace it was created in
+void unlinkRegion(const std::string& name, bool is_hugetlb) {
+  std::ignore = is_hugetlb ? ::unlink(hugeTlbPath(name).c_str()) : ::shm_unlink(name.c_str());
+}
+
+//-------------------------------------------------------------------------------------------------
+// Apply placement and residency options to a freshly mapped region. Returns the name of the
+// failed system call, if any, with errno set.
+auto applyOptions(std::span<std::byte> region, grape::SharedMemory::Access access,
+                  const grape::SharedMemory::Options& options) -> std::string_view {
+  using HugePages = grape::SharedMemory::Options::HugePages;
+  if (options.huge_pages == HugePages::Transparent) {
+    if (::madvise(region.data(), region.size_bytes(), MADV_HUGEPAGE) == -1) {
+      return "madvise";
+    }
+  }
+
+  // Binding must precede the first touch of the pages, which is why populating a NUMA-bound
+  // region is deferred to here rather than requested from mmap() with MAP_POPULATE
+  if (options.numa_node.has_value()) {
+    static constexpr auto MAX_NODES = sizeof(unsigned long) * CHAR_BIT;
+    if (options.numa_node.value() >= MAX_NODES) {
+      errno = EINVAL;
+      return "mbind";
+    }
+    const auto node_mask = 1UL << options.numa_node.value();
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+    if (::syscall(SYS_mbind, region.data(), region.size_bytes(), MPOL_BIND, &node_mask,
+                  MAX_NODES + 1U, MPOL_MF_STRICT) == -1) {
+      return "mbind";
+    }
+    if (options.populate and not options.lock) {
+      const auto is_writable = (access == grape::SharedMemory::Access::ReadWrite);
+      const auto advice = is_writable ? MADV_POPULATE_WRITE : MADV_POPULATE_READ;
+      if (::madvise(region.data(), region.size_bytes(), advice) == -1) {
+        return "madvise";
+      }
+    }
+  }
+
+  // mlock() faults in all pages before locking them
+  if (options.lock) {
+    if (::mlock(region.data(), region.size_bytes()) == -1) {
+      return "mlock";
+    }
+  }
+  return {};
+}
+
+}  // namespace
 
 namespace grape {
 
 //-------------------------------------------------------------------------------------------------
 auto SharedMemory::exists(const std::string& name) -> bool {
-  const auto fd = ::shm_open(name.c_str(), O_RDONLY, 0);
+  const auto fd = openRegion(name, O_RDONLY);
   const auto exists = (fd > 0);
   if (exists) {
     ::close(fd);
@@ -36,12 +115,15 @@ auto SharedMemory::remove(const std::string& name) -> std::expected<void, Error>
     return {};
   }
   const auto err = std::error_code(errno, std::system_category());
+  if ((err.value() == ENOENT) and (::unlink(hugeTlbPath(name).c_str()) == 0)) {
+    return {};  // region was created with explicit huge pages
+  }
   return std::unexpected(Error{ "(shm_unlink) ", err.message() });
 }
 
 //-------------------------------------------------------------------------------------------------
-auto SharedMemory::create(const std::string& name, std::size_t size, Access access)
-    -> std::expected<SharedMemory, Error> {
+auto SharedMemory::create(const std::string& name, std::size_t size, Access access,
+                          const Options& options) -> std::expected<SharedMemory, Error> {
   // Flags to specify shm file creation behaviour:
   // - O_CREAT: create shm path if it does not exist
   // - O_EXCL: raise error if shm path already exists before creation
@@ -55,25 +137,54 @@ auto SharedMemory::create(const std::string& name, std::size_t size, Access acce
   // for the new object. (i.e. effective mode = MODE & ~umask)
   static constexpr auto MODE = S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | S_IROTH;
 
+  // Explicit huge pages are only available from hugetlbfs, not from the tmpfs behind shm_open(). So
+  // such regions are created as files on the hugetlbfs mount point instead.
+  const auto is_hugetlb = (options.huge_pages == Options::HugePages::HugeTlb);
+
   // const auto process_mask = umask(0);  // temporarily reset process mode so we can set any mode
-  const auto fd = ::shm_open(name.c_str(), OFLAGS, MODE);
+  const auto fd = is_hugetlb ?
+                      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+                      ::open(hugeTlbPath(name).c_str(), OFLAGS | O_CLOEXEC, MODE) :
+                      ::shm_open(name.c_str(), OFLAGS, MODE);
   // umask(process_mask);  // reinstate process mode mask
   if (fd == -1) {
     const auto err = std::error_code(errno, std::system_category());
-    return std::unexpected(Error{ "(shm_open) ", err.message() });
+    return std::unexpected(Error{ is_hugetlb ? "(open) " : "(shm_open) ", err.message() });
+  }
+
+  // On any failure from here on, release the descriptor and remove the region so that the name can
+  // be reused
+  const auto fail = [&name, fd, is_hugetlb](std::string_view failed_call) {
+    const auto err = std::error_code(errno, std::system_category());
+    ::close(fd);
+    unlinkRegion(name, is_hugetlb);
+    return std::unexpected(Error{ "(", failed_call, ") ", err.message() });
+  };
+
+  // hugetlbfs only accepts sizes in multiples of its page size
+  if (is_hugetlb) {
+    struct statfs fs_stats{};
+    if (::fstatfs(fd, &fs_stats) == -1) {
+      return fail("fstatfs");
+    }
+    if (fs_stats.f_type != HUGETLBFS_MAGIC) {
+      ::close(fd);
+      unlinkRegion(name, is_hugetlb);
+      return std::unexpected(Error{ HUGETLBFS_PATH, " is not a hugetlbfs mount" });
+    }
+    const auto page_size = static_cast<std::size_t>(fs_stats.f_bsize);
+    size = ((size + page_size - 1U) / page_size) * page_size;
   }
 
   // set size of shared memory
   if (::ftruncate(fd, static_cast<off_t>(size)) == -1) {
-    const auto err = std::error_code(errno, std::system_category());
-    return std::unexpected(Error{ "(ftruncate) ", err.message() });
+    return fail("ftruncate");
   }
 
   // note the size we actually got
   struct stat stats{};
   if (::fstat(fd, &stats) == -1) {
-    const auto err = std::error_code(errno, std::system_category());
-    return std::unexpected(Error{ "(fstat) ", err.message() });
+    return fail("fstat");
   }
   size = static_cast<std::size_t>(stats.st_size);
 
@@ -83,17 +194,26 @@ auto SharedMemory::create(const std::string& name, std::size_t size, Access acce
   /// @note The address returned is page aligned and meets the alignment requirement of any data
   /// type on the host
   const auto prot = ((access == Access::ReadWrite) ? (PROT_READ | PROT_WRITE) : PROT_READ);
+  const auto populate = (options.populate and not options.numa_node.has_value());
+  const auto flags = MAP_SHARED | (populate ? MAP_POPULATE : 0);
   const auto offset = 0;
-  auto* shm_area = ::mmap(nullptr, size, prot, MAP_SHARED, fd, offset);
+  auto* shm_area = ::mmap(nullptr, size, prot, flags, fd, offset);
   if (shm_area == MAP_FAILED) {
-    const auto err = std::error_code(errno, std::system_category());
-    return std::unexpected(Error{ "(mmap) ", err.message() });
+    return fail("mmap");
   }
   ::close(fd);  // Not needed anymore
 
   SharedMemory shm;
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
   shm.data_ = std::span<std::byte>{ reinterpret_cast<std::byte*>(shm_area), size };
+
+  const auto failed_call = applyOptions(shm.data_, access, options);
+  if (not failed_call.empty()) {
+    const auto err = std::error_code(errno, std::system_category());
+    shm.close();
+    unlinkRegion(name, is_hugetlb);
+    return std::unexpected(Error{ "(", failed_call, ") ", err.message() });
+  }
   return shm;
 }
 
@@ -102,8 +222,7 @@ auto SharedMemory::open(const std::string& name, Access access)
     -> std::expected<SharedMemory, Error> {
   // Open existing shared memory object
   const auto oflag = ((access == Access::ReadWrite) ? O_RDWR : O_RDONLY);
-  static constexpr auto MODE = 0;  // unused
-  const auto fd = ::shm_open(name.c_str(), oflag, MODE);
+  const auto fd = openRegion(name, oflag);
   if (fd == -1) {
     const auto err = std::error_code(errno, std::system_category());
     return std::unexpected(Error{ "(shm_open) ", err.message() });
@@ -113,6 +232,7 @@ auto SharedMemory::open(const std::string& name, Access access)
   struct stat stats{};
   if (::fstat(fd, &stats) == -1) {
     const auto err = std::error_code(errno, std::system_category());
+    ::close(fd);
     return std::unexpected(Error{ "(fstat) ", err.message() });
   }
 
@@ -123,6 +243,7 @@ auto SharedMemory::open(const std::string& name, Access access)
   auto* shm_area = ::mmap(nullptr, size, prot, MAP_SHARED, fd, OFFSET);
   if (shm_area == MAP_FAILED) {
     const auto err = std::error_code(errno, std::system_category());
+    ::close(fd);
     return std::unexpected(Error{ "(mmap) ", err.message() });
   }
   ::close(fd);  // Not needed anymore
@@ -100,6 +100,66 @@ TEST_CASE("Basic write and read", "[SharedMemory]") {
   std::ignore = ShMem::remove(test_shm_name);
 }
 
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Placement and residency options", "[SharedMemory]") {
+  const auto test_data = createRandomData();
+  const auto write_read = [&test_data](const ShMem::Options& options) {
+    const auto test_shm_name = createUniqueShmName();
+    auto maybe_shm =
+        ShMem::create(test_shm_name, test_data.size(), ShMem::Access::ReadWrite, options);
+    REQUIRE(maybe_shm.has_value());
+    REQUIRE(maybe_shm->data().size() == test_data.size());
+    std::ranges::copy(test_data, std::begin(maybe_shm->data()));
+
+    auto maybe_shm_open = ShMem::open(test_shm_name, ShMem::Access::ReadOnly);
+    REQUIRE(maybe_shm_open.has_value());
+    REQUIRE(std::ranges::equal(maybe_shm_open->data(), test_data));
+    REQUIRE(ShMem::remove(test_shm_name));
+  };
+
+  SECTION("Pre-faulted") {
+    write_read({ .populate = true });
+  }
+  SECTION("Locked") {
+    write_read({ .lock = true });
+  }
+  SECTION("Transparent huge pages") {
+    write_read({ .huge_pages = ShMem::Options::HugePages::Transparent, .populate = true });
+  }
+  SECTION("Bound to NUMA node") {
+    write_read({ .populate = true, .numa_node = 0U });
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Failure to apply options does not leave region behind", "[SharedMemory]") {
+  const auto test_shm_name = createUniqueShmName();
+  static constexpr auto INVALID_NODE = 4096U;
+  const auto options = ShMem::Options{ .numa_node = INVALID_NODE };
+  REQUIRE_FALSE(ShMem::create(test_shm_name, TEST_SHM_SIZE, ShMem::Access::ReadWrite, options));
+  REQUIRE_FALSE(ShMem::exists(test_shm_name));
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Regions backed by explicit huge pages", "[SharedMemory]") {
+  const auto test_shm_name = createUniqueShmName();
+  const auto options = ShMem::Options{ .huge_pages = ShMem::Options::HugePages::HugeTlb };
+  auto maybe_shm = ShMem::create(test_shm_name, TEST_SHM_SIZE, ShMem::Access::ReadWrite, options);
+  if (not maybe_shm) {
+    // Host has no hugetlbfs mount or no huge pages reserved
+    REQUIRE_FALSE(ShMem::exists(test_shm_name));
+    return;
+  }
+  // size is rounded up to the huge page size
+  REQUIRE(maybe_shm->data().size() >= TEST_SHM_SIZE);
+  REQUIRE(ShMem::exists(test_shm_name));
+  auto maybe_shm_open = ShMem::open(test_shm_name, ShMem::Access::ReadOnly);
+  REQUIRE(maybe_shm_open.has_value());
+  REQUIRE(maybe_shm_open->data().size() == maybe_shm->data().size());
+  REQUIRE(ShMem::remove(test_shm_name));
+  REQUIRE_FALSE(ShMem::exists(test_shm_name));
+}
+
 //-------------------------------------------------------------------------------------------------
 TEST_CASE("SharedMemory move semantics", "[SharedMemory]") {
   SECTION("Move constructor works correctly") {
@@ -8,6 +8,7 @@
 #include <string>
 
 #include "grape/clock/follower_clock.h"
+#include "grape/shared_memory.h"
 
 namespace grape::clock {
 
@@ -17,7 +18,8 @@ namespace grape::clock {
 class ClockBroadcaster {
 public:
   struct Config {
-    std::string name;  //!< Uniquely identifies the broadcaster
+    std::string name;                //!< Uniquely identifies the broadcaster
+    SharedMemory::Options memory{};  //!< Placement of the tick (e.g. lock to avoid page faults)
   };
 
   /// Construct and start the driver
@@ -58,10 +58,11 @@ struct ShmTick : SharedMemory {
     return std::format("/{}{}", id, TICK_SHM_NAME_SUFFIX);
   }
 
-  static auto init(std::string_view id, SharedMemory::Access access) -> SharedMemory {
+  static auto init(std::string_view id, SharedMemory::Access access,
+                   const SharedMemory::Options& options = {}) -> SharedMemory {
     // Try to create shared memory. If that fails, try to open. If that fails, give up
     const auto shm_name = shmName(id);
-    auto maybe_shm = SharedMemory::create(shm_name, TICK_SIZE, access);
+    auto maybe_shm = SharedMemory::create(shm_name, TICK_SIZE, access, options);
     if (not maybe_shm) {
       const auto prev_msg = std::string{ maybe_shm.error().message() };
       maybe_shm = SharedMemory::open(shm_name, access);
@@ -200,6 +200,16 @@ constexpr auto ProgramOptions::get(std::string_view key) const -> T {
     // note: since std::istringstream extracts only up to whitespace, this special case is
     // neccessary for parsing strings containing multiple words
     return it->second.value;
+  } else if constexpr (std::is_same_v<T, bool>) {
+    // a boolean option given without a value (--key) is a flag that is set
+    const auto& value = it->second.value;
+    if (value.empty() || (value == "true")) {
+      return true;
+    }
+    if (value == "false") {
+      return false;
+    }
+    panic(std::format("Unparsable option: {}={}", key, value));
   } else if constexpr (std::is_enum_v<T>) {
     const auto opt = grape::enums::cast<T>(it->second.value);
     if (not opt.has_value()) {
@@ -184,6 +184,22 @@ TEST_CASE("Invalid enum strings cannot be passed as enum values", "[program_opti
   REQUIRE_THROWS(args.get<Speed>("speed"));
 }
 
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Boolean option is a flag that is set when given without a value", "[program_options]") {
+  // NOLINTBEGIN(cppcoreguidelines-avoid-c-arrays,cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+  const char* argv[] = { "--verbose", "--color=false" };
+  const auto argc = 2;
+  const auto args = ProgramDescription("flag test")
+                        .declareOption<bool>("verbose", "Verbose output", false)
+                        .declareOption<bool>("color", "Colored output", true)
+                        .declareOption<bool>("quiet", "Quiet output", false)
+                        .parse(argc, argv);
+  // NOLINTEND(cppcoreguidelines-avoid-c-arrays,cppcoreguidelines-pro-bounds-array-to-pointer-decay)
+  REQUIRE(args.get<bool>("verbose"));
+  REQUIRE_FALSE(args.get<bool>("color"));
+  REQUIRE_FALSE(args.get<bool>("quiet"));
+}
+
 //-------------------------------------------------------------------------------------------------
 TEST_CASE("Optional vector argument uses default if unspecified", "[program_options]") {
   const std::vector<int> default_values = { 100, 200, 300 };
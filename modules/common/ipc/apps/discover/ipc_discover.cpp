@@ -18,22 +18,25 @@
 #include "grape/ipc/discovery.h"
 #include "grape/ipc/session.h"
 #include "grape/utils/enums.h"
+#include "grape/wall_clock.h"
 
 //=================================================================================================
-// Discovers IPC endpoints and prints them to the console.
+// Discovers IPC endpoints and prints them to the console. Prints the full graph every interval
+// or, in watch mode, endpoints as they come and go.
 //
 // Typical usage:
 // ```code
-// ipc_discover [--scope=Network|Host] [--interval=2.0]
+// ipc_discover [--scope=Network|Host] [--interval=2.0] [--watch]
 // ```
 //=================================================================================================
 
 namespace {
 
 //-------------------------------------------------------------------------------------------------
-void printDiscovery() {
+void printDiscovery(const grape::ipc::DiscoveryCache& cache) {
   std::println("\n---");
-  const auto discovered_topics = grape::ipc::discover();
+  const auto snapshot = cache.snapshot();
+  const auto& discovered_topics = *snapshot;
   if (discovered_topics.empty()) {
     std::println("(no topics discovered)");
     return;
@@ -52,6 +55,14 @@ void printDiscovery() {
   }
 }
 
+//-------------------------------------------------------------------------------------------------
+void printEvent(const grape::ipc::DiscoveryEvent& event) {
+  using Kind = grape::ipc::DiscoveryEvent::Kind;
+  std::println("{} {} {:<10} \033[1mtopic: '{}'\033[0m {}", grape::WallClock::now(),
+               (event.kind == Kind::Added) ? "\033[32m+\033[0m" : "\033[31m-\033[0m",
+               grape::enums::name(event.role), event.topic, toString(event.endpoint));
+}
+
 }  // namespace
 
 //=================================================================================================
@@ -68,19 +79,25 @@ auto main(int argc, const char* argv[]) -> int {
         conio::ProgramDescription("Discover and print all IPC endpoints")
             .declareOption<double>("interval", "refresh interval in seconds", DEFAULT_INTERVAL)
             .declareOption<ipc::Config::Scope>("scope", "scope [Network|Host]", DEFAULT_SCOPE)
+            .declareOption<bool>("watch", "print endpoints as they come and go", false)
             .parse(argc, argv);
 
     const auto interval = std::chrono::duration<double>(args.get<double>("interval"));
     const auto scope = args.get<ipc::Config::Scope>("scope");
+    const auto is_watch = args.get<bool>("watch");
 
     ipc::init(ipc::Config{ .scope = scope });
 
-    std::println("Discovering IPC endpoints. scope={}, interval={}", enums::name(scope), interval);
+    std::println("Discovering IPC endpoints. scope={}, interval={}, watch={}", enums::name(scope),
+                 interval, is_watch);
 
     std::println("Press CTRL-C to quit");
+    const auto cache = ipc::DiscoveryCache(is_watch ? printEvent : nullptr);
     while (ipc::ok()) {
       std::this_thread::sleep_for(interval);
-      printDiscovery();
+      if (not is_watch) {
+        printDiscovery(cache);
+      }
     }
 
     return EXIT_SUCCESS;
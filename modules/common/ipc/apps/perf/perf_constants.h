@@ -4,6 +4,10 @@
 
 #pragma once
 
+#include <cstdint>
+#include <format>
+
+#include "grape/ipc/qos.h"
 #include "grape/ipc/topic.h"
 
 namespace grape::ipc::ex::perf {
@@ -14,4 +18,20 @@ static auto topic() -> const Topic& {
   };
   return topic;
 }
+
+/// Topic on which perf_ping sends payloads for perf_pong to echo. One per QoS
+static auto pingTopic(QoS qos) -> Topic {
+  return { .name = std::format("grape/ipc/example/perf/ping/{}", toString(qos)),
+           .type_name = "bytes" };
+}
+
+/// Topic on which perf_pong echoes payloads back to perf_ping. One per QoS
+static auto pongTopic(QoS qos) -> Topic {
+  return { .name = std::format("grape/ipc/example/perf/pong/{}", toString(qos)),
+           .type_name = "bytes" };
+}
+
+/// Output formats for reports
+enum class ReportFormat : std::uint8_t { Text, Csv, Json };
+
 }  // namespace grape::ipc::ex::perf
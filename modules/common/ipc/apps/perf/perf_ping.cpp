@@ -0,0 +1,283 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <print>
+#include <semaphore>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include "grape/conio/program_options.h"
+#include "grape/exception.h"
+#include "grape/ipc/config.h"
+#include "grape/ipc/qos.h"
+#include "grape/ipc/raw_publisher.h"
+#include "grape/ipc/raw_subscriber.h"
+#include "grape/ipc/session.h"
+#include "grape/statistics/histogram.h"
+#include "grape/utils/enums.h"
+#include "perf_constants.h"
+
+//=================================================================================================
+// Initiating end of ping/pong pair that measures round-trip latency between endpoints.
+//
+// Sends payloads of increasing size to perf_pong and times their echo on a single steady clock,
+// so results are unaffected by clock offsets between hosts and by timestamp resolution of the
+// transport. Sweeps payload sizes for each QoS, then prints a summary table, or CSV/JSON lines
+// for comparing runs in automated pipelines. Run once per session scope.
+//
+// Typical usage:
+// ```code
+// perf_ping [--scope=Network] [--min_size=64] [--max_size=16777216] [--format=Csv]
+// ```
+//
+// Paired with example: perf_pong.cpp
+//=================================================================================================
+
+namespace {
+
+using ReportFormat = grape::ipc::ex::perf::ReportFormat;
+using Histogram = grape::statistics::LogLinearHistogram<>;
+
+//=================================================================================================
+/// Round-trip statistics for one payload size and QoS
+struct Summary {
+  grape::ipc::Config::Scope scope{};
+  grape::ipc::QoS qos{};
+  std::size_t size{};
+  std::uint64_t count{};
+  std::uint64_t timeouts{};
+  double mean_ns{};
+  std::uint64_t p50_ns{};
+  std::uint64_t p90_ns{};
+  std::uint64_t p99_ns{};
+  std::uint64_t p999_ns{};
+  std::uint64_t max_ns{};
+};
+
+//=================================================================================================
+/// Sends pings and waits for their echo for a given QoS
+class Pinger {
+public:
+  explicit Pinger(grape::ipc::QoS qos)
+    : ping_(grape::ipc::ex::perf::pingTopic(qos))
+    , pong_(grape::ipc::ex::perf::pongTopic(qos), qos,
+            [this](const grape::ipc::Sample& sample) { onPong(sample); }) {
+  }
+
+  /// @return true if echoing end was found within timeout
+  [[nodiscard]] auto waitForMatch(std::chrono::milliseconds timeout) const -> bool {
+    static constexpr auto POLL_INTERVAL = std::chrono::milliseconds(100);
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    while ((ping_.subscriberCount() == 0U) || (pong_.publisherCount() == 0U)) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        return false;
+      }
+      std::this_thread::sleep_for(POLL_INTERVAL);
+    }
+    return true;
+  }
+
+  /// Exchange a payload with the echoing end
+  /// @return round-trip time, or nothing on timeout
+  auto exchange(std::vector<std::byte>& payload, std::chrono::milliseconds timeout)
+      -> std::optional<std::chrono::nanoseconds> {
+    const auto seq = expected_seq_.load() + 1U;
+    std::memcpy(payload.data(), &seq, sizeof(seq));
+    expected_seq_.store(seq);
+    while (pong_received_.try_acquire()) {
+      // discard echo of a previous ping that arrived after it timed out
+    }
+    const auto start = std::chrono::steady_clock::now();
+    if (not ping_.publish(payload)) {
+      return std::nullopt;
+    }
+    if (not pong_received_.try_acquire_for(timeout)) {
+      return std::nullopt;
+    }
+    return std::chrono::steady_clock::now() - start;
+  }
+
+private:
+  void onPong(const grape::ipc::Sample& sample) {
+    auto seq = std::uint64_t{};
+    if (sample.data.size_bytes() < sizeof(seq)) {
+      return;
+    }
+    std::memcpy(&seq, sample.data.data(), sizeof(seq));
+    if (seq == expected_seq_.load()) {
+      pong_received_.release();
+    }
+  }
+
+  grape::ipc::RawPublisher ping_;
+  std::atomic_uint64_t expected_seq_{ 0 };
+  std::binary_semaphore pong_received_{ 0 };
+  grape::ipc::RawSubscriber pong_;
+};
+
+//-------------------------------------------------------------------------------------------------
+auto measure(Pinger& pinger, std::size_t size, std::size_t iterations,
+             std::chrono::milliseconds timeout, Histogram& rtt_ns) -> std::uint64_t {
+  static constexpr auto WARMUP_ITERATIONS = 10U;
+  auto payload = std::vector<std::byte>(size);
+  for (auto i = 0U; i < WARMUP_ITERATIONS; ++i) {
+    std::ignore = pinger.exchange(payload, timeout);
+  }
+  rtt_ns.reset();
+  auto timeouts = std::uint64_t{ 0 };
+  for (auto i = 0UZ; i < iterations; ++i) {
+    const auto rtt = pinger.exchange(payload, timeout);
+    if (not rtt) {
+      ++timeouts;
+      continue;
+    }
+    rtt_ns.record(static_cast<std::uint64_t>(rtt->count()));
+  }
+  return timeouts;
+}
+
+//-------------------------------------------------------------------------------------------------
+void printHeader(ReportFormat format) {
+  switch (format) {
+    case ReportFormat::Text:
+      std::println("{:>8} {:>11} {:>10} {:>7} {:>8} {:>10} {:>10} {:>10} {:>10} {:>10} {:>10}",
+                   "scope", "qos", "bytes", "count", "timeouts", "mean_us", "p50_us", "p90_us",
+                   "p99_us", "p99.9_us", "max_us");
+      break;
+    case ReportFormat::Csv:
+      std::println("scope,qos,bytes,count,timeouts,rtt_mean_ns,rtt_p50_ns,rtt_p90_ns,rtt_p99_ns,"
+                   "rtt_p999_ns,rtt_max_ns");
+      break;
+    case ReportFormat::Json:
+      break;
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+void print(const Summary& s, ReportFormat format) {
+  const auto scope = grape::enums::name(s.scope);
+  const auto qos = toString(s.qos);
+  switch (format) {
+    case ReportFormat::Text: {
+      static constexpr auto NS_PER_US = 1e3;
+      const auto us = [](auto ns) { return static_cast<double>(ns) / NS_PER_US; };
+      std::println("{:>8} {:>11} {:>10} {:>7} {:>8} {:>10.1f} {:>10.1f} {:>10.1f} {:>10.1f} "
+                   "{:>10.1f} {:>10.1f}",
+                   scope, qos, s.size, s.count, s.timeouts, us(s.mean_ns), us(s.p50_ns),
+                   us(s.p90_ns), us(s.p99_ns), us(s.p999_ns), us(s.max_ns));
+      break;
+    }
+    case ReportFormat::Csv:
+      std::println("{},{},{},{},{},{:.0f},{},{},{},{},{}", scope, qos, s.size, s.count, s.timeouts,
+                   s.mean_ns, s.p50_ns, s.p90_ns, s.p99_ns, s.p999_ns, s.max_ns);
+      break;
+    case ReportFormat::Json:
+      std::println(R"({{"scope":"{}","qos":"{}","bytes":{},"count":{},"timeouts":{},)"
+                   R"("rtt_mean_ns":{:.0f},"rtt_p50_ns":{},"rtt_p90_ns":{},"rtt_p99_ns":{},)"
+                   R"("rtt_p999_ns":{},"rtt_max_ns":{}}})",
+                   scope, qos, s.size, s.count, s.timeouts, s.mean_ns, s.p50_ns, s.p90_ns,
+                   s.p99_ns, s.p999_ns, s.max_ns);
+      break;
+  }
+}
+
+}  // namespace
+
+//=================================================================================================
+auto main(int argc, const char* argv[]) -> int {
+  try {
+    static constexpr auto DEFAULT_MIN_SIZE = 64UZ;
+    static constexpr auto DEFAULT_MAX_SIZE = 16UZ * 1024UZ * 1024UZ;
+    static constexpr auto DEFAULT_ITERATIONS = 200UZ;
+    static constexpr auto DEFAULT_TIMEOUT_MS = 1000UZ;
+    static constexpr auto MATCH_TIMEOUT = std::chrono::seconds(10);
+
+    const auto args =
+        grape::conio::ProgramDescription(
+            "Initiating end of IPC round-trip latency application pair")
+            .declareOption<std::string>("scope", "Session scope [Host|Network]", "Host")
+            .declareOption<std::size_t>("min_size", "Smallest payload in bytes", DEFAULT_MIN_SIZE)
+            .declareOption<std::size_t>("max_size", "Largest payload in bytes", DEFAULT_MAX_SIZE)
+            .declareOption<std::size_t>("iterations", "Round trips per size", DEFAULT_ITERATIONS)
+            .declareOption<std::size_t>("timeout", "Round trip timeout (ms)", DEFAULT_TIMEOUT_MS)
+            .declareOption<std::string>("format", "Report format [Text|Csv|Json]", "Text")
+            .parse(argc, argv);
+
+    const auto maybe_scope =
+        grape::enums::cast<grape::ipc::Config::Scope>(args.get<std::string>("scope"));
+    if (not maybe_scope) {
+      std::println("Invalid scope specified");
+      return EXIT_FAILURE;
+    }
+    const auto maybe_format = grape::enums::cast<ReportFormat>(args.get<std::string>("format"));
+    if (not maybe_format) {
+      std::println("Invalid report format specified");
+      return EXIT_FAILURE;
+    }
+    const auto scope = maybe_scope.value();
+    const auto format = maybe_format.value();
+    const auto min_size = std::max(args.get<std::size_t>("min_size"), sizeof(std::uint64_t));
+    const auto max_size = std::max(args.get<std::size_t>("max_size"), min_size);
+    const auto iterations = args.get<std::size_t>("iterations");
+    const auto timeout = std::chrono::milliseconds(args.get<std::size_t>("timeout"));
+
+    grape::ipc::init(grape::ipc::Config{ .scope = scope });
+
+    auto summaries = std::vector<Summary>{};
+    auto rtt_ns = std::make_unique<Histogram>();
+    for (const auto qos : { grape::ipc::QoS::BestEffort, grape::ipc::QoS::Reliable }) {
+      auto pinger = Pinger(qos);
+      if (not pinger.waitForMatch(MATCH_TIMEOUT)) {
+        std::println("No perf_pong found for {} QoS. Is it running in {} scope?", toString(qos),
+                     grape::enums::name(scope));
+        return EXIT_FAILURE;
+      }
+      for (auto size = min_size; size <= max_size; size *= 2U) {
+        if (format == ReportFormat::Text) {
+          std::print("\r[{}] {} bytes...        ", toString(qos), size);
+          std::fflush(stdout);
+        }
+        const auto timeouts = measure(pinger, size, iterations, timeout, *rtt_ns);
+        summaries.push_back({ .scope = scope,
+                              .qos = qos,
+                              .size = size,
+                              .count = rtt_ns->count(),
+                              .timeouts = timeouts,
+                              .mean_ns = rtt_ns->mean(),
+                              .p50_ns = rtt_ns->percentile(50.),      // NOLINT(*-magic-numbers)
+                              .p90_ns = rtt_ns->percentile(90.),      // NOLINT(*-magic-numbers)
+                              .p99_ns = rtt_ns->percentile(99.),      // NOLINT(*-magic-numbers)
+                              .p999_ns = rtt_ns->percentile(99.9),    // NOLINT(*-magic-numbers)
+                              .max_ns = rtt_ns->max() });
+        if (not grape::ipc::ok()) {
+          return EXIT_FAILURE;
+        }
+      }
+    }
+    if (format == ReportFormat::Text) {
+      std::println("\r");
+    }
+
+    printHeader(format);
+    for (const auto& summary : summaries) {
+      print(summary, format);
+    }
+    return EXIT_SUCCESS;
+  } catch (...) {
+    grape::Exception::print();
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,98 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <print>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "grape/conio/program_options.h"
+#include "grape/exception.h"
+#include "grape/ipc/config.h"
+#include "grape/ipc/match.h"
+#include "grape/ipc/qos.h"
+#include "grape/ipc/raw_publisher.h"
+#include "grape/ipc/raw_subscriber.h"
+#include "grape/ipc/session.h"
+#include "grape/utils/enums.h"
+#include "perf_constants.h"
+
+//=================================================================================================
+// Echoing end of ping/pong pair that measures round-trip latency between endpoints. Every payload
+// received on a ping topic is published back unmodified on the corresponding pong topic, for
+// each QoS.
+//
+// Typical usage:
+// ```code
+// perf_pong [--scope=Network]
+// ```
+//
+// Paired with example: perf_ping.cpp
+//=================================================================================================
+
+namespace {
+
+//=================================================================================================
+/// Echoes payloads from ping topic to pong topic for a given QoS
+class Echo {
+public:
+  explicit Echo(grape::ipc::QoS qos)
+    : pong_(grape::ipc::ex::perf::pongTopic(qos))
+    , ping_(grape::ipc::ex::perf::pingTopic(qos), qos,
+            [this](const grape::ipc::Sample& sample) { echo(sample); }, onMatch) {
+  }
+
+private:
+  void echo(const grape::ipc::Sample& sample) {
+    const auto result = pong_.publish(sample.data);
+    if (not result) {
+      std::println("ERROR: {}", toString(result.error()));
+    }
+  }
+
+  static void onMatch(const grape::ipc::Match& match) {
+    std::println("{} '{}' on '{}'", toString(match.status), toString(match.remote_entity),
+                 match.topic.name);
+  }
+
+  grape::ipc::RawPublisher pong_;
+  grape::ipc::RawSubscriber ping_;
+};
+
+}  // namespace
+
+//=================================================================================================
+auto main(int argc, const char* argv[]) -> int {
+  try {
+    const auto args =
+        grape::conio::ProgramDescription("Echoing end of IPC round-trip latency application pair")
+            .declareOption<std::string>("scope", "Session scope [Host|Network]", "Host")
+            .parse(argc, argv);
+    const auto maybe_scope =
+        grape::enums::cast<grape::ipc::Config::Scope>(args.get<std::string>("scope"));
+    if (not maybe_scope) {
+      std::println("Invalid scope specified");
+      return EXIT_FAILURE;
+    }
+
+    grape::ipc::init(grape::ipc::Config{ .scope = maybe_scope.value() });
+
+    auto echoes = std::vector<std::unique_ptr<Echo>>{};
+    echoes.push_back(std::make_unique<Echo>(grape::ipc::QoS::BestEffort));
+    echoes.push_back(std::make_unique<Echo>(grape::ipc::QoS::Reliable));
+
+    std::println("Press CTRL+C to exit");
+    static constexpr auto LOOP_WAIT = std::chrono::milliseconds(100);
+    while (grape::ipc::ok()) {
+      std::this_thread::sleep_for(LOOP_WAIT);
+    }
+    return EXIT_SUCCESS;
+  } catch (...) {
+    grape::Exception::print();
+    return EXIT_FAILURE;
+  }
+}
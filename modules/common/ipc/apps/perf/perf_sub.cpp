@@ -2,12 +2,14 @@
 // Copyright (C) 2025 GRAPE Contributors
 //=================================================================================================
 
+#include <algorithm>
 #include <array>
 #include <chrono>
 #include <cmath>
 #include <compare>
 #include <cstdint>
 #include <cstdlib>
+#include <memory>
 #include <optional>
 #include <print>
 #include <ratio>
@@ -25,6 +27,7 @@
 #include "grape/ipc/raw_subscriber.h"
 #include "grape/ipc/session.h"
 #include "grape/ipc/topic.h"
+#include "grape/statistics/histogram.h"
 #include "grape/utils/enums.h"
 #include "grape/wall_clock.h"
 #include "perf_constants.h"
@@ -34,41 +37,83 @@
 //
 // Typical usage:
 // ```code
-// perf_sub
+// perf_sub --qos=BestEffort [--format=Csv]
 // ```
 //
+// Reports message and byte rates, samples missed, and latency percentiles, once every second.
+// Reports are human-readable text by default, or CSV/JSON lines for comparing runs in automated
+// pipelines.
+//
 // Paired with example: perf_pub.cpp
 //=================================================================================================
 
 namespace {
+using ReportFormat = grape::ipc::ex::perf::ReportFormat;
+
 //=================================================================================================
 /// Encapsulates data and model for statistics calculations
 struct Statistics {
   static constexpr auto REPORT_DURATION = std::chrono::seconds(1);
   uint64_t msg_count{ 0 };
   uint64_t aggregate_bytes{ 0 };
-  grape::WallClock::Duration aggregate_latency{ 0 };
+  uint64_t missed_count{ 0 };
+  uint64_t last_sequence{ 0 };
+  grape::statistics::LogLinearHistogram<> latency_ns;
   grape::WallClock::TimePoint start;
-  void print() const;
+  void print(ReportFormat format) const;
   void reset();
   void add(const grape::WallClock::TimePoint& ts, const grape::ipc::Sample& sample);
 };
 
 //-------------------------------------------------------------------------------------------------
-void Statistics::print() const {
+void printHeader(ReportFormat format) {
+  if (format == ReportFormat::Csv) {
+    std::println("msg_rate,byte_rate,missed,latency_mean_ns,latency_p50_ns,latency_p90_ns,"
+                 "latency_p99_ns,latency_p999_ns,latency_max_ns");
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+void Statistics::print(ReportFormat format) const {
   const auto stop = grape::WallClock::now();
   const auto dt = std::chrono::duration<double>(stop - start).count();
   const auto msg_rate = std::floor(static_cast<double>(msg_count) / dt);
   const auto byte_rate = std::floor(static_cast<double>(aggregate_bytes) / dt);
-  const auto avg_latency = aggregate_latency / static_cast<double>(msg_count);
-  std::println("  [{} msg/s] [{} bytes/sec] [{} latency]", msg_rate, byte_rate, avg_latency);
+  const auto mean = std::floor(latency_ns.mean());
+  const auto p50 = latency_ns.percentile(50.);   // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+  const auto p90 = latency_ns.percentile(90.);   // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+  const auto p99 = latency_ns.percentile(99.);   // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+  const auto p999 = latency_ns.percentile(99.9);  // NOLINT(cppcoreguidelines-avoid-magic-numbers)
+  const auto max = latency_ns.max();
+  switch (format) {
+    case ReportFormat::Text: {
+      using Micros = std::chrono::duration<double, std::micro>;
+      const auto us = [](auto ns) { return Micros(std::chrono::nanoseconds(ns)); };
+      std::println("  [{} msg/s] [{} bytes/sec] [{} missed] [latency mean {:.1f} p50 {:.1f} "
+                   "p90 {:.1f} p99 {:.1f} p99.9 {:.1f} max {:.1f}]",
+                   msg_rate, byte_rate, missed_count, us(static_cast<std::int64_t>(mean)), us(p50),
+                   us(p90), us(p99), us(p999), us(max));
+      break;
+    }
+    case ReportFormat::Csv:
+      std::println("{},{},{},{},{},{},{},{},{}", msg_rate, byte_rate, missed_count, mean, p50, p90,
+                   p99, p999, max);
+      break;
+    case ReportFormat::Json:
+      std::println(R"({{"msg_rate":{},"byte_rate":{},"missed":{},"latency_mean_ns":{},)"
+                   R"("latency_p50_ns":{},"latency_p90_ns":{},"latency_p99_ns":{},)"
+                   R"("latency_p999_ns":{},"latency_max_ns":{}}})",
+                   msg_rate, byte_rate, missed_count, mean, p50, p90, p99, p999, max);
+      break;
+  }
 }
 
 //-------------------------------------------------------------------------------------------------
 void Statistics::reset() {
   msg_count = 0;
   aggregate_bytes = 0;
-  aggregate_latency = {};
+  missed_count = 0;
+  latency_ns.reset();
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -78,7 +123,14 @@ void Statistics::add(const grape::WallClock::TimePoint& ts, const grape::ipc::Sa
   }
   msg_count++;
   aggregate_bytes += sample.data.size_bytes();
-  aggregate_latency += (ts - sample.info.publish_time);
+  const auto sequence = sample.info.sequence;
+  if ((last_sequence != 0) && (sequence > last_sequence)) {
+    missed_count += sequence - last_sequence - 1;
+  }
+  last_sequence = sequence;
+  // clocks on different hosts may be offset, making latency appear negative. Count that as 0
+  const auto latency = std::chrono::nanoseconds(ts - sample.info.publish_time).count();
+  latency_ns.record(static_cast<std::uint64_t>(std::max<std::int64_t>(latency, 0)));
 }
 }  // namespace
 
@@ -90,31 +142,44 @@ auto main(int argc, const char* argv[]) -> int {
             "Subscribing/reporting end of IPC performance measurement application pair")
             .declareOption<std::string>("qos", "Quality of service [BestEffort|Reliable]")
             .declareOption<std::string>("topic", "Topic", grape::ipc::ex::perf::topic().name)
+            .declareOption<std::string>("format", "Report format [Text|Csv|Json]", "Text")
             .parse(argc, argv);
     const auto maybe_qos = grape::enums::cast<grape::ipc::QoS>(args.get<std::string>("qos"));
     if (not maybe_qos) {
       std::println("Invalid QoS specified");
       return EXIT_FAILURE;
     }
+    const auto maybe_format = grape::enums::cast<ReportFormat>(args.get<std::string>("format"));
+    if (not maybe_format) {
+      std::println("Invalid report format specified");
+      return EXIT_FAILURE;
+    }
+    const auto format = maybe_format.value();
 
     const auto config = grape::ipc::Config{ .scope = grape::ipc::Config::Scope::Network };
     grape::ipc::init(config);
 
-    Statistics stats;
+    auto stats = std::make_unique<Statistics>();
+    printHeader(format);
 
-    const auto data_cb = [&stats](const grape::ipc::Sample& sample) -> void {
+    const auto data_cb = [&stats, format](const grape::ipc::Sample& sample) -> void {
       const auto ts = grape::WallClock::now();
-      stats.add(ts, sample);
-      static constexpr std::array<char, 4> PROGRESS{ '|', '/', '-', '\\' };
-      std::print("\r[{}]", PROGRESS.at(stats.msg_count % 4));
+      stats->add(ts, sample);
+      if (format == ReportFormat::Text) {
+        static constexpr std::array<char, 4> PROGRESS{ '|', '/', '-', '\\' };
+        std::print("\r[{}]", PROGRESS.at(stats->msg_count % 4));
+      }
 
-      if (ts - stats.start > Statistics::REPORT_DURATION) {
-        stats.print();
-        stats.reset();
+      if (ts - stats->start > Statistics::REPORT_DURATION) {
+        stats->print(format);
+        stats->reset();
       }
     };
 
-    const auto match_cb = [](const grape::ipc::Match& match) {
+    const auto match_cb = [format](const grape::ipc::Match& match) {
+      if (format != ReportFormat::Text) {
+        return;  // keep machine-readable output clean
+      }
       std::println("{} '{}' [data type: '{}']", toString(match.status),
                    toString(match.remote_entity), match.topic.type_name);
     };
@@ -122,7 +187,9 @@ auto main(int argc, const char* argv[]) -> int {
     const auto topic = args.get<std::string>("topic");
     auto sub = grape::ipc::RawSubscriber(topic, maybe_qos.value(), data_cb, match_cb);
 
-    std::println("Press CTRL+C to exit");
+    if (format == ReportFormat::Text) {
+      std::println("Press CTRL+C to exit");
+    }
     static constexpr auto LOOP_WAIT = std::chrono::milliseconds(100);
     while (grape::ipc::ok()) {
       std::this_thread::sleep_for(LOOP_WAIT);
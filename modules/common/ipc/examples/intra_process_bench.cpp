@@ -0,0 +1,193 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <expected>
+#include <format>
+#include <memory>
+#include <semaphore>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <sys/wait.h>  // for waitpid
+#include <unistd.h>    // for fork
+
+#include "grape/ipc/config.h"
+#include "grape/ipc/publisher.h"
+#include "grape/ipc/session.h"
+#include "grape/ipc/subscriber.h"
+
+//=================================================================================================
+// Compares round-trip time of typed messages between endpoints in the same process, which are
+// delivered directly without serialisation, against endpoints in different processes, which go
+// through serialisation and the transport. Each round trip is a ping published to an echoing
+// subscriber that publishes it back as a pong. The echo for the inter-process case runs in a
+// child process forked at startup.
+//=================================================================================================
+
+namespace {
+
+struct Payload {
+  std::uint64_t seq{};
+  std::vector<float> values;
+};
+
+//-------------------------------------------------------------------------------------------------
+template <int ID>
+struct BenchTopic {
+  using DataType = Payload;
+  static constexpr auto QOS = grape::ipc::QoS::BestEffort;
+  static constexpr auto SERDES_BUFFER_SIZE = 16UZ * 1024UZ * 1024UZ;
+  std::string name;
+  [[nodiscard]] auto topicName() const -> std::string {
+    return name;
+  }
+};
+using PingTopic = BenchTopic<0>;
+using PongTopic = BenchTopic<1>;
+
+//-------------------------------------------------------------------------------------------------
+auto pingTopic(const std::string& scope) -> PingTopic {
+  return { .name = std::format("grape/ipc/bench/{}/ping", scope) };
+}
+
+//-------------------------------------------------------------------------------------------------
+auto pongTopic(const std::string& scope) -> PongTopic {
+  return { .name = std::format("grape/ipc/bench/{}/pong", scope) };
+}
+
+//=================================================================================================
+/// Publishes every ping received back as a pong
+class Echo {
+public:
+  explicit Echo(const std::string& scope)
+    : pong_(pongTopic(scope))
+    , ping_(pingTopic(scope),
+            [this](const std::expected<Payload, grape::ipc::Error>& data,
+                   const grape::ipc::SampleInfo& /*info*/) {
+              if (data) {
+                std::ignore = pong_.publish(*data);
+              }
+            }) {
+  }
+
+private:
+  grape::ipc::Publisher<PongTopic> pong_;
+  grape::ipc::Subscriber<PingTopic> ping_;
+};
+
+//=================================================================================================
+/// Publishes pings and waits for their pongs
+class Pinger {
+public:
+  explicit Pinger(const std::string& scope)
+    : ping_(pingTopic(scope))
+    , pong_(pongTopic(scope),
+            [this](const std::expected<Payload, grape::ipc::Error>& data,
+                   const grape::ipc::SampleInfo& /*info*/) {
+              if (data && (data->seq == expected_seq_.load())) {
+                pong_received_.release();
+              }
+            }) {
+    static constexpr auto MATCH_TIMEOUT = std::chrono::seconds(10);
+    static constexpr auto POLL_INTERVAL = std::chrono::milliseconds(100);
+    const auto deadline = std::chrono::steady_clock::now() + MATCH_TIMEOUT;
+    while ((ping_.subscriberCount() == 0U) || (pong_.publisherCount() == 0U)) {
+      if (std::chrono::steady_clock::now() > deadline) {
+        throw std::runtime_error("Echo not found");
+      }
+      std::this_thread::sleep_for(POLL_INTERVAL);
+    }
+  }
+
+  /// @return true if pong was received in time
+  auto roundTrip(std::size_t num_values) -> bool {
+    static constexpr auto TIMEOUT = std::chrono::seconds(1);
+    payload_.values.resize(num_values);
+    payload_.seq++;
+    expected_seq_.store(payload_.seq);
+    if (not ping_.publish(payload_)) {
+      return false;
+    }
+    return pong_received_.try_acquire_for(TIMEOUT);
+  }
+
+private:
+  Payload payload_;
+  std::atomic_uint64_t expected_seq_{ 0 };
+  std::binary_semaphore pong_received_{ 0 };
+  grape::ipc::Publisher<PingTopic> ping_;
+  grape::ipc::Subscriber<PongTopic> pong_;
+};
+
+//-------------------------------------------------------------------------------------------------
+void roundTrips(benchmark::State& state, Pinger& pinger) {
+  const auto num_values = static_cast<std::size_t>(state.range(0));
+  for (auto st : state) {
+    (void)st;
+    if (not pinger.roundTrip(num_values)) {
+      state.SkipWithError("Round trip timed out");
+      return;
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<std::int64_t>(num_values) *
+                          static_cast<std::int64_t>(sizeof(float)));
+}
+
+//-------------------------------------------------------------------------------------------------
+void bmRoundTripIntraProcess(benchmark::State& state) {
+  static auto echo = Echo("intra");
+  static auto pinger = Pinger("intra");
+  roundTrips(state, pinger);
+}
+
+//-------------------------------------------------------------------------------------------------
+void bmRoundTripInterProcess(benchmark::State& state) {
+  static auto pinger = Pinger("inter");
+  roundTrips(state, pinger);
+}
+
+constexpr auto SMALL_SIZE = 16;
+constexpr auto MEDIUM_SIZE = 16 * 1024;
+constexpr auto LARGE_SIZE = 1024 * 1024;
+
+BENCHMARK(bmRoundTripIntraProcess)->Arg(SMALL_SIZE)->Arg(MEDIUM_SIZE)->Arg(LARGE_SIZE);
+BENCHMARK(bmRoundTripInterProcess)->Arg(SMALL_SIZE)->Arg(MEDIUM_SIZE)->Arg(LARGE_SIZE);
+
+}  // namespace
+
+//=================================================================================================
+auto main(int argc, char** argv) -> int {
+  // fork before IPC is initialised, so each process gets its own session
+  const auto echo_pid = fork();
+  if (echo_pid < 0) {
+    return EXIT_FAILURE;
+  }
+  if (echo_pid == 0) {
+    grape::ipc::init(grape::ipc::Config{ .name = "intra_process_bench_echo" });
+    const auto echo = Echo("inter");
+    static constexpr auto LOOP_WAIT = std::chrono::milliseconds(100);
+    while (grape::ipc::ok() && (getppid() != 1)) {
+      std::this_thread::sleep_for(LOOP_WAIT);
+    }
+    return EXIT_SUCCESS;
+  }
+
+  grape::ipc::init(grape::ipc::Config{});
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  kill(echo_pid, SIGTERM);
+  waitpid(echo_pid, nullptr, 0);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,34 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace grape::ipc {
+
+/// Configuration for coalescing messages published to other processes into batches, each sent
+/// through the transport as a single frame. Amortises the transport's per-message overhead over
+/// many small messages published at high rate, at the cost of added latency.
+///
+/// A batch is sent (flushed) when the first of the configured limits is reached. Subscribers
+/// unbatch frames transparently and receive each message individually, with its own SampleInfo.
+/// Subscribers in the same process are not affected and receive messages immediately.
+struct BatchConfig {
+  static constexpr auto DEFAULT_MAX_MESSAGES = 32UZ;
+  static constexpr auto DEFAULT_MAX_BYTES = 64UZ * 1024UZ;
+  static constexpr auto DEFAULT_MAX_DELAY = std::chrono::milliseconds(1);
+
+  /// Flush once this many messages are batched
+  std::size_t max_messages{ DEFAULT_MAX_MESSAGES };
+
+  /// Flush before a batch would exceed this many bytes. A larger message is sent on its own
+  std::size_t max_bytes{ DEFAULT_MAX_BYTES };
+
+  /// Flush once the oldest message in a batch is this old. Zero disables this limit
+  std::chrono::nanoseconds max_delay{ DEFAULT_MAX_DELAY };
+};
+
+}  // namespace grape::ipc
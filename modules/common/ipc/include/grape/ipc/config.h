@@ -17,6 +17,11 @@ struct Config {
   };
   std::string name = utils::getProgramName();  //!< user-defined identifier
   Scope scope = Scope::Host;
+
+  /// Deliver samples between publishers and subscribers in the same process directly, bypassing
+  /// the transport. Disable to route them through the transport like samples from other processes
+  /// (e.g. to test it within a single process)
+  bool intra_process = true;
 };
 
 }  // namespace grape::ipc
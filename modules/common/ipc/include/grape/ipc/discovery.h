@@ -4,7 +4,10 @@
 
 #pragma once
 
+#include <cstdint>
 #include <format>
+#include <functional>
+#include <memory>
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -34,4 +37,47 @@ using TopicName = std::string;
 /// @return Active IPC endpoints known to ipc::Session at the time of this call.
 [[nodiscard]] auto discover() -> std::unordered_map<TopicName, Endpoints>;
 
+//=================================================================================================
+/// An endpoint appearing or disappearing, as reported by DiscoveryCache
+struct DiscoveryEvent {
+  enum class Kind : std::uint8_t { Added, Removed };
+  enum class Role : std::uint8_t { Publisher, Subscriber };
+  Kind kind{ Kind::Added };
+  Role role{ Role::Publisher };
+  TopicName topic;
+  EndpointInfo endpoint;
+};
+
+//=================================================================================================
+/// Keeps the graph of active IPC endpoints up to date incrementally, from registration events
+/// raised by the transport. Unlike discover(), querying it does not go back to the transport, so
+/// it suits applications that watch the graph continuously.
+class DiscoveryCache {
+public:
+  using Graph = std::unordered_map<TopicName, Endpoints>;
+  using EventCallback = std::function<void(const DiscoveryEvent&)>;
+
+  /// Creates the cache, populated with endpoints active at the time of this call
+  /// @param event_cb Optional. Called for every endpoint added or removed, starting with those
+  /// found on construction. Callbacks are serialised and may call snapshot()
+  explicit DiscoveryCache(EventCallback&& event_cb = nullptr);
+
+  /// @return Active IPC endpoints. Consecutive calls return the same snapshot until the graph
+  /// changes
+  [[nodiscard]] auto snapshot() const -> std::shared_ptr<const Graph>;
+
+  /// @return Number of changes to the graph so far. Cheap way to tell whether it has changed
+  [[nodiscard]] auto version() const -> std::uint64_t;
+
+  ~DiscoveryCache();
+  DiscoveryCache(const DiscoveryCache&) = delete;
+  DiscoveryCache(DiscoveryCache&&) = delete;
+  auto operator=(const DiscoveryCache&) = delete;
+  auto operator=(DiscoveryCache&&) = delete;
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
 }  // namespace grape::ipc
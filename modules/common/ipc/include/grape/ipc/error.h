@@ -13,6 +13,7 @@ enum class Error : std::uint8_t {
   SerialisationFailed,    //!< Error serialising data before publishing
   PublishFailed,          //!< Error writing data to the transport layer
   DeserialisationFailed,  //!< Error deserialising data in the subscriber
+  SchemaMismatch,         //!< Data was serialised from a type of different layout than expected
 };
 
 [[nodiscard]] constexpr auto toString(Error error) -> std::string_view {
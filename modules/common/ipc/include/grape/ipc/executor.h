@@ -0,0 +1,40 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "grape/utils/enums.h"
+
+namespace grape::ipc {
+
+/// Configuration for delivering received samples to a subscriber's data callback from a pool of
+/// worker threads, instead of directly from the transport's receive thread.
+///
+/// Received samples are copied into a bounded per-subscriber queue, from which the workers invoke
+/// the callback. A slow callback then only backs up its own queue, rather than stalling delivery
+/// on the topic. With more than one worker, callbacks may run concurrently and complete out of
+/// order.
+struct ExecutorConfig {
+  /// Defines how the queue handles newly received samples
+  enum class Policy : std::uint8_t {
+    KeepAll,     //!< If queue is full, hold receive thread until there is space. Nothing is dropped
+    DropOldest,  //!< If queue is full, drop the oldest queued sample to make space
+    KeepLatest,  //!< Replace all queued samples, so only the most recent sample is delivered
+  };
+
+  static constexpr auto DEFAULT_QUEUE_DEPTH = 16UZ;
+
+  std::size_t queue_depth{ DEFAULT_QUEUE_DEPTH };  //!< Maximum number of queued samples
+  std::size_t num_workers{ 1 };                    //!< Number of threads invoking the callback
+  Policy policy{ Policy::DropOldest };
+};
+
+[[nodiscard]] constexpr auto toString(ExecutorConfig::Policy policy) -> std::string_view {
+  return grape::enums::name(policy);
+}
+
+}  // namespace grape::ipc
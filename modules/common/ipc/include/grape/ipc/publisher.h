@@ -4,9 +4,13 @@
 
 #pragma once
 
+#include <optional>
+#include <typeinfo>
+
 #include "grape/ipc/raw_publisher.h"
 #include "grape/ipc/topic.h"
 #include "grape/serdes/serdes.h"
+#include "grape/serdes/size.h"
 #include "grape/serdes/stream.h"
 
 namespace grape::ipc {
@@ -14,31 +18,50 @@ namespace grape::ipc {
 //=================================================================================================
 /// Publisher templated on topic attributes
 ///
+/// Data is serialised directly into memory of the transport, sized exactly to fit it using
+/// serdes::serialisedSize(), so there is no serialisation buffer in the publisher. Topics may
+/// bound the serialised size by defining SERDES_BUFFER_SIZE (see BoundedTopicAttributes).
 template <TopicAttributes TopicAttr>
 class Publisher : public RawPublisher {
 public:
-  explicit Publisher(const TopicAttr& topic_attr, MatchCallback&& match_cb = nullptr);
-  [[nodiscard]] auto publish(const TopicAttr::DataType& data) -> std::expected<void, Error>;
+  /// Creates a publisher
+  /// @param topic_attr Topic attributes
+  /// @param match_cb Match callback, triggered on matched/unmatched with a remote subscriber
+  /// @param batching If specified, messages to other processes are sent in batches as configured
+  explicit Publisher(const TopicAttr& topic_attr, MatchCallback&& match_cb = nullptr,
+                     const std::optional<BatchConfig>& batching = std::nullopt);
 
-private:
-  using OutStream = serdes::OutStream<TopicAttr::SERDES_BUFFER_SIZE>;
-  OutStream byte_stream_;
-  serdes::Serialiser<OutStream> serialiser_;
+  /// Publish data. Subscribers in this process receive it without serialisation. For others, it
+  /// is serialised directly into transport memory.
+  /// @return nothing on success, Error::SerialisationFailed if data does not serialise within
+  /// TopicAttr::SERDES_BUFFER_SIZE bytes (if defined), or other error on failure
+  [[nodiscard]] auto publish(const TopicAttr::DataType& data) -> std::expected<void, Error>;
 };
 
 //-------------------------------------------------------------------------------------------------
 template <TopicAttributes TopicAttr>
-Publisher<TopicAttr>::Publisher(const TopicAttr& topic_attr, MatchCallback&& match_cb)
-  : RawPublisher(toTopic(topic_attr), std::move(match_cb)), serialiser_(byte_stream_) {
+Publisher<TopicAttr>::Publisher(const TopicAttr& topic_attr, MatchCallback&& match_cb,
+                                const std::optional<BatchConfig>& batching)
+  : RawPublisher(toTopic(topic_attr), std::move(match_cb), batching) {
 }
 
 //-------------------------------------------------------------------------------------------------
 template <TopicAttributes TopicAttr>
 auto Publisher<TopicAttr>::publish(const TopicAttr::DataType& data) -> std::expected<void, Error> {
-  byte_stream_.reset();
-  if (not serialiser_.pack(data)) {
-    return std::unexpected{ Error::SerialisationFailed };
-  }
-  return RawPublisher::publish(byte_stream_.data());
+  using DataType = typename TopicAttr::DataType;
+  // Compute encoded size first, since the transport needs it before handing out memory to write
+  const auto measure = [&data]() -> std::optional<std::size_t> {
+    const auto size = serdes::serialisedSize(data);
+    if (size > serialisedSizeLimit<TopicAttr>()) {
+      return std::nullopt;
+    }
+    return size;
+  };
+  const auto write = [&data](std::span<std::byte> buffer) -> bool {
+    auto stream = serdes::SpanOutStream(buffer);
+    auto serialiser = serdes::Serialiser(stream);
+    return serialiser.pack(data) and (stream.size() == buffer.size_bytes());
+  };
+  return RawPublisher::publish(&data, typeid(DataType), measure, write);
 }
 }  // namespace grape::ipc
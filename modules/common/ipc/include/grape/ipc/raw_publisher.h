@@ -7,11 +7,16 @@
 #include <cstddef>
 #include <cstdint>
 #include <expected>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <span>
+#include <typeindex>
 
+#include "grape/ipc/batching.h"
 #include "grape/ipc/error.h"
 #include "grape/ipc/match.h"
+#include "grape/ipc/stats.h"
 
 namespace grape::ipc {
 struct Topic;
@@ -19,29 +24,76 @@ struct Topic;
 //=================================================================================================
 /// Publishers post data on a topic.
 ///
+/// Subscribers in the same process receive data directly, with their callbacks invoked
+/// synchronously on the publishing thread: publish() returns once they have, so a slow callback
+/// delays the publisher. Subscribers configured with an executor only queue the data instead. The
+/// transport is only used if there are subscribers in other processes.
 class RawPublisher {
 public:
   /// Creates a publisher
   /// @param topic Topic on which to publish data
   /// @param match_cb Match callback, triggered on matched/unmatched with a remote subscriber
-  explicit RawPublisher(const Topic& topic, MatchCallback&& match_cb = nullptr);
+  /// @param batching If specified, messages to other processes are sent in batches as configured
+  explicit RawPublisher(const Topic& topic, MatchCallback&& match_cb = nullptr,
+                        const std::optional<BatchConfig>& batching = std::nullopt);
+
+  /// Signature of a function that writes a message in-place. See publish(std::size_t, ...)
+  /// @return true on success, false to abandon the message
+  using WriteCallback = std::function<bool(std::span<std::byte>)>;
 
   /// Publish data on topic specified at construction
   /// @return nothing on success, error on failure
   [[nodiscard]] auto publish(std::span<const std::byte> bytes) const -> std::expected<void, Error>;
 
+  /// Publish a message by writing it directly into memory owned by the transport layer (e.g. the
+  /// shared memory segment for local subscribers). Unlike publish(bytes), this avoids first
+  /// composing the message in a separate buffer only for it to be copied into the transport.
+  /// @param size Exact size of the message in bytes
+  /// @param writer Function invoked with a writable view of exactly `size` bytes, which it must
+  /// fill completely. Not invoked if there are no subscribers to deliver the message to.
+  /// @return nothing on success, Error::SerialisationFailed if writer returned false, or other
+  /// error on failure
+  [[nodiscard]] auto publish(std::size_t size, const WriteCallback& writer) const
+      -> std::expected<void, Error>;
+
+  /// Send messages batched so far without waiting for a batch limit to be reached. Does nothing
+  /// unless batching is configured
+  /// @return nothing on success, error on failure
+  [[nodiscard]] auto flush() const -> std::expected<void, Error>;
+
   /// @return The number of subscribers currently matched to this publisher
   [[nodiscard]] auto subscriberCount() const -> std::size_t;
 
   /// @return Unique identifier for this endpoint on the network
   [[nodiscard]] auto id() const -> std::uint64_t;
 
+  /// @return Statistics of messages published since creation
+  [[nodiscard]] auto stats() const -> EndpointStats;
+
   virtual ~RawPublisher();
   RawPublisher(RawPublisher&&) noexcept;
   RawPublisher(const RawPublisher&) = delete;
   auto operator=(const RawPublisher&) = delete;
   auto operator=(RawPublisher&&) noexcept = delete;
 
+protected:
+  /// Signature of a function that returns the exact size of the message written by a
+  /// WriteCallback, or nothing if the message cannot be written
+  using SizeCallback = std::function<std::optional<std::size_t>()>;
+
+  /// Publish an object. Subscribers in this process that accept objects of its type receive it by
+  /// address, without serialisation. For all other subscribers, the message is serialised as in
+  /// publish(std::size_t, ...), but only if there are any.
+  /// @param object Address of the object to publish
+  /// @param type Type of the object
+  /// @param size Returns the size of the serialised message. Invoked once, also to count bytes in
+  /// statistics if the message is not serialised
+  /// @param writer Serialises the message. Only invoked if required
+  /// @return nothing on success, Error::SerialisationFailed if size or writer failed, or other
+  /// error on failure
+  [[nodiscard]] auto publish(const void* object, std::type_index type, const SizeCallback& size,
+                             const WriteCallback& writer) const -> std::expected<void, Error>;
+
 private:
   struct Impl;
   std::unique_ptr<Impl> impl_;
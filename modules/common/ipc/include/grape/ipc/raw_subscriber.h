@@ -8,11 +8,15 @@
 #include <cstdint>  // for uint64_t
 #include <functional>
 #include <memory>
+#include <optional>
 #include <span>
 #include <string>
+#include <typeindex>
 
 #include "grape/ipc/entity_id.h"
+#include "grape/ipc/executor.h"
 #include "grape/ipc/match.h"
+#include "grape/ipc/stats.h"
 #include "grape/wall_clock.h"
 
 namespace grape::ipc {
@@ -23,7 +27,8 @@ struct Topic;
 //=================================================================================================
 /// Meta information about data contained in a sample
 struct SampleInfo {
-  WallClock::TimePoint publish_time;
+  WallClock::TimePoint publish_time;  //!< Time of publication, with nanosecond resolution
+  std::uint64_t sequence;             //!< Publisher's running count of samples published
   EntityId publisher;
   std::string type_name;
 };
@@ -37,26 +42,41 @@ struct Sample {
 
 //=================================================================================================
 /// Subscribers receive topic data.
+///
+/// Samples from publishers in the same process bypass the transport: they are delivered directly,
+/// with the data callback invoked synchronously on the publishing thread (or queued for the
+/// executor, if one is configured). Callbacks may publish on the topic and create or destroy other
+/// endpoints on it, but a subscriber must not be destroyed from within its own callback.
 class RawSubscriber {
 public:
   /// Function signature for callback on received data
   using DataCallback = std::function<void(const Sample&)>;
 
+  /// Function signature for callback on an object published from within the same process,
+  /// handed over by address instead of serialised. See Publisher and Subscriber
+  using TypedCallback = std::function<void(const void*, const SampleInfo&)>;
+
   /// creates a subscriber
   /// @param topic Topic on which to listen to for data from matched publishers
   /// @param qos Quality of service desired on this topic
   /// @param data_cb Data processing callback, triggered on every newly received data sample
   /// @param match_cb Match callback, triggered when matched/unmatched with a remote publisher
+  /// @param executor If specified, data callback is triggered from a pool of worker threads as
+  /// configured, instead of from the transport's receive thread
   RawSubscriber(const Topic& topic, QoS qos, DataCallback&& data_cb,
-                MatchCallback&& match_cb = nullptr);
+                MatchCallback&& match_cb = nullptr,
+                const std::optional<ExecutorConfig>& executor = std::nullopt);
 
   /// Creates a subscriber with only topic name specified. Data callback must handle types
   /// @param topic_name Name of the topic on which to listen to for data from matched publishers
   /// @param qos Quality of service desired on this topic
   /// @param data_cb Data processing callback, triggered on every newly received data sample
   /// @param match_cb Match callback, triggered when matched/unmatched with a remote publisher
+  /// @param executor If specified, data callback is triggered from a pool of worker threads as
+  /// configured, instead of from the transport's receive thread
   RawSubscriber(const std::string& topic_name, QoS qos, DataCallback&& data_cb,
-                MatchCallback&& match_cb = nullptr);
+                MatchCallback&& match_cb = nullptr,
+                const std::optional<ExecutorConfig>& executor = std::nullopt);
 
   /// @return The number of publishers currently matched to this subscriber
   [[nodiscard]] auto publisherCount() const -> std::size_t;
@@ -64,12 +84,41 @@ public:
   /// @return Unique identifier for this endpoint on the network
   [[nodiscard]] auto id() const -> std::uint64_t;
 
+  /// @return Number of received samples waiting for delivery to the data callback. Always 0
+  /// unless an executor is configured
+  [[nodiscard]] auto queueDepth() const -> std::size_t;
+
+  /// @return Number of received samples dropped before delivery to the data callback, as per the
+  /// executor queueing policy. Always 0 unless an executor is configured
+  [[nodiscard]] auto dropCount() const -> std::uint64_t;
+
+  /// @return Number of samples missed, inferred from gaps in sequence numbers of samples received
+  /// from each publisher
+  [[nodiscard]] auto gapCount() const -> std::uint64_t;
+
+  /// @return Number of samples received with a sequence number no greater than one already
+  /// received from the same publisher (i.e. repeated or out of order)
+  [[nodiscard]] auto duplicateCount() const -> std::uint64_t;
+
+  /// @return Statistics of samples delivered to the data callback since creation
+  [[nodiscard]] auto stats() const -> EndpointStats;
+
   virtual ~RawSubscriber();
   RawSubscriber(RawSubscriber&&) noexcept;
   RawSubscriber(const RawSubscriber&) = delete;
   auto operator=(const RawSubscriber&) = delete;
   auto operator=(RawSubscriber&&) noexcept = delete;
 
+protected:
+  /// Creates a subscriber that also accepts objects of a given type, without serialisation,
+  /// from publishers in the same process
+  /// @param type Type of objects accepted by typed_cb
+  /// @param typed_cb Callback on objects of `type` from publishers in this process. Not used if
+  /// an executor is specified, as the executor must copy samples for deferred delivery
+  RawSubscriber(const Topic& topic, QoS qos, DataCallback&& data_cb, MatchCallback&& match_cb,
+                const std::optional<ExecutorConfig>& executor, std::type_index type,
+                TypedCallback&& typed_cb);
+
 private:
   struct Impl;
   std::unique_ptr<Impl> impl_;
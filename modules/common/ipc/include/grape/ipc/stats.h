@@ -0,0 +1,87 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "grape/ipc/entity_id.h"
+#include "grape/ipc/qos.h"
+#include "grape/statistics/histogram.h"
+
+namespace grape::ipc {
+
+/// Histogram of latencies in nanoseconds, to within 3%. See statistics::LogLinearHistogram
+using LatencyHistogram = statistics::LogLinearHistogram<6>;
+
+//=================================================================================================
+/// Statistics of a publisher or subscriber since its creation. Endpoints update the underlying
+/// counters lock-free as messages pass; this is a snapshot of them.
+struct EndpointStats {
+  std::uint64_t messages{ 0 };       //!< Messages published, or delivered to the data callback
+  std::uint64_t bytes{ 0 };          //!< Serialised size, even of objects handed over as is
+  std::uint64_t dropped{ 0 };        //!< Drop events reported by the transport
+  std::uint64_t send_failures{ 0 };  //!< Messages or batches the transport failed to send
+  std::chrono::nanoseconds callback_time{ 0 };  //!< Time spent in the data callback
+  LatencyHistogram latency;  //!< Latency from publish to delivery to the data callback
+};
+
+//=================================================================================================
+/// Summary of an endpoint's statistics, as published periodically by StatsReporter
+struct EndpointStatsReport {
+  enum class Role : std::uint8_t { Publisher, Subscriber };
+  Role role{ Role::Publisher };
+  std::string topic;
+  EntityId endpoint;
+  std::uint64_t messages{ 0 };
+  std::uint64_t bytes{ 0 };
+  std::uint64_t dropped{ 0 };
+  std::uint64_t send_failures{ 0 };
+  double message_rate{ 0. };  //!< Messages per second over the last reporting period
+  double byte_rate{ 0. };     //!< Bytes per second over the last reporting period
+  std::chrono::nanoseconds callback_time{ 0 };
+  std::chrono::nanoseconds latency_p50{ 0 };
+  std::chrono::nanoseconds latency_p99{ 0 };
+  std::chrono::nanoseconds latency_max{ 0 };
+};
+
+//=================================================================================================
+/// Attributes of the topic on which StatsReporter publishes
+struct StatsTopic {
+  using DataType = EndpointStatsReport;
+  static constexpr auto QOS = QoS::BestEffort;
+  static constexpr auto SERDES_BUFFER_SIZE = 1024UZ;
+  [[nodiscard]] static auto topicName() -> std::string {
+    return "grape/ipc/stats";
+  }
+};
+
+//=================================================================================================
+/// Periodically publishes statistics of every publisher and subscriber in this process on
+/// StatsTopic, as one EndpointStatsReport per endpoint, for consumption by dashboards.
+class StatsReporter {
+public:
+  static constexpr auto DEFAULT_PERIOD = std::chrono::milliseconds(1000);
+
+  /// Starts reporting
+  /// @param period Interval between reports
+  explicit StatsReporter(std::chrono::milliseconds period = DEFAULT_PERIOD);
+
+  /// Stops reporting
+  ~StatsReporter();
+
+  StatsReporter(const StatsReporter&) = delete;
+  StatsReporter(StatsReporter&&) = delete;
+  auto operator=(const StatsReporter&) = delete;
+  auto operator=(StatsReporter&&) = delete;
+
+private:
+  struct Impl;
+  std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace grape::ipc
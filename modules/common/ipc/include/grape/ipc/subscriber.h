@@ -5,6 +5,12 @@
 #pragma once
 
 #include <expected>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <typeinfo>
+#include <vector>
 
 #include "grape/ipc/error.h"
 #include "grape/ipc/raw_subscriber.h"
@@ -14,37 +20,172 @@
 
 namespace grape::ipc {
 
+namespace detail {
+
+//=================================================================================================
+/// Pool of objects to decode samples into, reused across callbacks. Callbacks running
+/// concurrently (executor with multiple workers) or re-entrantly each get their own object.
+template <typename T>
+class DecodeTargets {
+public:
+  [[nodiscard]] auto acquire() -> std::unique_ptr<T> {
+    const auto lock = std::lock_guard(mutex_);
+    if (free_.empty()) {
+      return std::make_unique<T>(std::in_place);
+    }
+    auto target = std::move(free_.back());
+    free_.pop_back();
+    return target;
+  }
+
+  void release(std::unique_ptr<T>&& target) {
+    const auto lock = std::lock_guard(mutex_);
+    free_.push_back(std::move(target));
+  }
+
+private:
+  std::mutex mutex_;
+  std::vector<std::unique_ptr<T>> free_;
+};
+
+}  // namespace detail
+
 //=================================================================================================
 /// Subscriber templated in topic attributes
 ///
+/// Samples are decoded into storage owned by the subscriber and reused across callbacks, so
+/// receiving samples of steady size does not allocate once that storage has grown to fit them.
+/// Data passed to the callback is only valid for the duration of the callback.
+///
+/// Objects from publishers in the same process are not serialised. A subscriber constructed with a
+/// DataCallback receives a copy of them, made into the reused storage, because the callback takes
+/// an std::expected. A subscriber constructed with ReferenceCallbacks receives a reference to the
+/// published object itself, without copying.
 template <TopicAttributes TopicAttr>
 class Subscriber : public RawSubscriber {
 public:
-  using DataCallback = std::function<void(const std::expected<typename TopicAttr::DataType, Error>&,
-                                          const SampleInfo&)>;
+  using DataType = typename TopicAttr::DataType;
+  using DataCallback =
+      std::function<void(const std::expected<DataType, Error>&, const SampleInfo&)>;
+
+  /// Callbacks that receive data by reference, and errors separately
+  struct ReferenceCallbacks {
+    std::function<void(const DataType&, const SampleInfo&)> on_data;
+    std::function<void(Error, const SampleInfo&)> on_error;
+  };
 
   Subscriber(const TopicAttr& topic_attr, DataCallback&& data_cb,
-             MatchCallback&& match_cb = nullptr);
+             MatchCallback&& match_cb = nullptr,
+             const std::optional<ExecutorConfig>& executor = std::nullopt);
+
+  Subscriber(const TopicAttr& topic_attr, ReferenceCallbacks&& callbacks,
+             MatchCallback&& match_cb = nullptr,
+             const std::optional<ExecutorConfig>& executor = std::nullopt);
+
+private:
+  /// Delivers samples to the callbacks, whether serialised or as objects
+  struct Receiver {
+    void onSample(const Sample& sample);
+    void onObject(const void* object, const SampleInfo& info);
+    void deliver(const std::expected<DataType, Error>& data, const SampleInfo& info);
+
+    DataCallback data_cb;
+    ReferenceCallbacks ref_cbs;
+    detail::DecodeTargets<std::expected<DataType, Error>> targets;
+    std::expected<DataType, Error> failed{ std::unexpected{ Error::DeserialisationFailed } };
+    std::expected<DataType, Error> mismatched{ std::unexpected{ Error::SchemaMismatch } };
+    std::string type_name{ schemaTypeName<DataType>() };
+  };
+
+  Subscriber(const TopicAttr& topic_attr, const std::shared_ptr<Receiver>& receiver,
+             MatchCallback&& match_cb, const std::optional<ExecutorConfig>& executor);
 };
 
 //-------------------------------------------------------------------------------------------------
 template <TopicAttributes TopicAttr>
 Subscriber<TopicAttr>::Subscriber(const TopicAttr& topic_attr, DataCallback&& data_cb,
-                                  MatchCallback&& match_cb)
+                                  MatchCallback&& match_cb,
+                                  const std::optional<ExecutorConfig>& executor)
+  : Subscriber(topic_attr, std::make_shared<Receiver>(std::move(data_cb)), std::move(match_cb),
+               executor) {
+}
+
+//-------------------------------------------------------------------------------------------------
+template <TopicAttributes TopicAttr>
+Subscriber<TopicAttr>::Subscriber(const TopicAttr& topic_attr, ReferenceCallbacks&& callbacks,
+                                  MatchCallback&& match_cb,
+                                  const std::optional<ExecutorConfig>& executor)
+  : Subscriber(topic_attr, std::make_shared<Receiver>(nullptr, std::move(callbacks)),
+               std::move(match_cb), executor) {
+}
+
+//-------------------------------------------------------------------------------------------------
+template <TopicAttributes TopicAttr>
+Subscriber<TopicAttr>::Subscriber(const TopicAttr& topic_attr,
+                                  const std::shared_ptr<Receiver>& receiver,
+                                  MatchCallback&& match_cb,
+                                  const std::optional<ExecutorConfig>& executor)
   : RawSubscriber(
         toTopic(topic_attr), topic_attr.QOS,
-        [moved_data_cb = std::move(data_cb)](const Sample& sample) {
-          if (not moved_data_cb) {
-            return;
-          }
-          auto result = std::expected<typename TopicAttr::DataType, Error>{ std::in_place };
-          auto stream = serdes::InStream(sample.data);
-          auto deserialiser = serdes::Deserialiser(stream);
-          if (not deserialiser.unpack(*result)) {
-            result = std::unexpected{ Error::DeserialisationFailed };
-          }
-          moved_data_cb(result, sample.info);
-        },
-        std::move(match_cb)) {
+        [receiver](const Sample& sample) { receiver->onSample(sample); }, std::move(match_cb),
+        executor, typeid(DataType),
+        [receiver](const void* object, const SampleInfo& info) {
+          receiver->onObject(object, info);
+        }) {
 }
+
+//-------------------------------------------------------------------------------------------------
+template <TopicAttributes TopicAttr>
+void Subscriber<TopicAttr>::Receiver::onSample(const Sample& sample) {
+  if (not data_cb and not ref_cbs.on_data and not ref_cbs.on_error) {
+    return;
+  }
+  if (not isSchemaCompatible(type_name, sample.info.type_name)) {
+    deliver(mismatched, sample.info);
+    return;
+  }
+  auto result = targets.acquire();
+  auto stream = serdes::InStream(sample.data);
+  auto deserialiser = serdes::Deserialiser(stream);
+  if (not deserialiser.unpack(**result)) {
+    deliver(failed, sample.info);
+    return;  // partly decoded, so not returned to the pool for reuse
+  }
+  deliver(*result, sample.info);
+  targets.release(std::move(result));
+}
+
+//-------------------------------------------------------------------------------------------------
+template <TopicAttributes TopicAttr>
+void Subscriber<TopicAttr>::Receiver::onObject(const void* object, const SampleInfo& info) {
+  if (ref_cbs.on_data) {
+    ref_cbs.on_data(*static_cast<const DataType*>(object), info);
+    return;
+  }
+  if (not data_cb) {
+    return;
+  }
+  auto result = targets.acquire();
+  **result = *static_cast<const DataType*>(object);
+  data_cb(*result, info);
+  targets.release(std::move(result));
+}
+
+//-------------------------------------------------------------------------------------------------
+template <TopicAttributes TopicAttr>
+void Subscriber<TopicAttr>::Receiver::deliver(const std::expected<DataType, Error>& data,
+                                              const SampleInfo& info) {
+  if (data_cb) {
+    data_cb(data, info);
+    return;
+  }
+  if (data.has_value()) {
+    if (ref_cbs.on_data) {
+      ref_cbs.on_data(*data, info);
+    }
+  } else if (ref_cbs.on_error) {
+    ref_cbs.on_error(data.error(), info);
+  }
+}
+
 }  // namespace grape::ipc
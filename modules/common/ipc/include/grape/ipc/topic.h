@@ -6,9 +6,12 @@
 
 #include <concepts>
 #include <format>
+#include <limits>
 #include <string>
+#include <string_view>
 
 #include "grape/ipc/qos.h"
+#include "grape/serdes/schema.h"
 #include "grape/utils/utils.h"
 
 namespace grape::ipc {
@@ -33,19 +36,60 @@ concept TopicAttributes = requires(T obj) {
   // Defines quality of service setting
   { T::QOS } -> std::convertible_to<QoS>;
 
-  // Defines max buffer size required to serialise data into raw bytes
-  { T::SERDES_BUFFER_SIZE } -> std::convertible_to<std::size_t>;
-
   // Has a method that returns topic name
   { obj.topicName() } -> std::convertible_to<std::string>;
 };
 
+//=================================================================================================
+/// Topic attributes that also define the maximum number of bytes data may serialise into, as
+/// T::SERDES_BUFFER_SIZE. Serialised data of topics that do not define it is unbounded in size.
+template <typename T>
+concept BoundedTopicAttributes = TopicAttributes<T> && requires {
+  { T::SERDES_BUFFER_SIZE } -> std::convertible_to<std::size_t>;
+};
+
+//-------------------------------------------------------------------------------------------------
+/// @return Maximum number of bytes data of the topic may serialise into
+template <TopicAttributes TopicAttr>
+[[nodiscard]] constexpr auto serialisedSizeLimit() -> std::size_t {
+  if constexpr (BoundedTopicAttributes<TopicAttr>) {
+    return TopicAttr::SERDES_BUFFER_SIZE;
+  } else {
+    return std::numeric_limits<std::size_t>::max();
+  }
+}
+
+/// Separates the name of a data type from the hash of its schema in Topic::type_name
+inline constexpr auto SCHEMA_HASH_SEPARATOR = '#';
+
+//-------------------------------------------------------------------------------------------------
+/// @return Type name for topics carrying data of type T. Made of the name of T followed by the hash
+/// of its structure (see serdes::schemaHash), so that endpoints can detect layout mismatches
+template <typename T>
+[[nodiscard]] auto schemaTypeName() -> std::string {
+  return std::format("{}{}{:016x}", utils::getTypeName<T>(), SCHEMA_HASH_SEPARATOR,
+                     serdes::schemaHash<T>());
+}
+
+//-------------------------------------------------------------------------------------------------
+/// Checks whether data published with one type name can be decoded as data of another
+/// @return false only if both type names carry a schema hash and the hashes differ
+[[nodiscard]] constexpr auto isSchemaCompatible(std::string_view type_name,
+                                                std::string_view other_type_name) -> bool {
+  const auto hash_pos = type_name.rfind(SCHEMA_HASH_SEPARATOR);
+  const auto other_hash_pos = other_type_name.rfind(SCHEMA_HASH_SEPARATOR);
+  if ((hash_pos == std::string_view::npos) or (other_hash_pos == std::string_view::npos)) {
+    return true;
+  }
+  return type_name.substr(hash_pos) == other_type_name.substr(other_hash_pos);
+}
+
 //-------------------------------------------------------------------------------------------------
 template <TopicAttributes TopicAttr>
-constexpr auto toTopic(const TopicAttr& topic_attr) -> Topic {
+auto toTopic(const TopicAttr& topic_attr) -> Topic {
   return Topic{
     .name = topic_attr.topicName(),
-    .type_name = std::string{ utils::getTypeName<typename TopicAttr::DataType>() },
+    .type_name = schemaTypeName<typename TopicAttr::DataType>(),
   };
 }
 
@@ -0,0 +1,67 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#pragma once
+
+#include <expected>
+#include <optional>
+
+#include "grape/ipc/error.h"
+#include "grape/ipc/raw_subscriber.h"
+#include "grape/ipc/topic.h"
+#include "grape/serdes/view.h"
+
+namespace grape::ipc {
+
+//=================================================================================================
+/// Subscriber templated in topic attributes that presents samples as read-only views instead of
+/// decoded copies.
+///
+/// The data callback receives a serdes::View over the received bytes. Members are decoded only
+/// when accessed, and strings and vectors of primitive values are read in place, so receiving a
+/// sample allocates nothing. Use this instead of Subscriber when samples are large or only a few
+/// members are of interest.
+///
+/// @note The view references memory owned by the transport and is only valid for the duration of
+/// the callback. Copy out what must be retained.
+template <TopicAttributes TopicAttr>
+  requires serdes::detail::SerializableAggregate<typename TopicAttr::DataType&>
+class ViewSubscriber : public RawSubscriber {
+public:
+  using DataView = serdes::View<typename TopicAttr::DataType>;
+  using DataCallback =
+      std::function<void(const std::expected<DataView, Error>&, const SampleInfo&)>;
+
+  ViewSubscriber(const TopicAttr& topic_attr, DataCallback&& data_cb,
+                 MatchCallback&& match_cb = nullptr,
+                 const std::optional<ExecutorConfig>& executor = std::nullopt);
+};
+
+//-------------------------------------------------------------------------------------------------
+template <TopicAttributes TopicAttr>
+  requires serdes::detail::SerializableAggregate<typename TopicAttr::DataType&>
+ViewSubscriber<TopicAttr>::ViewSubscriber(const TopicAttr& topic_attr, DataCallback&& data_cb,
+                                          MatchCallback&& match_cb,
+                                          const std::optional<ExecutorConfig>& executor)
+  : RawSubscriber(
+        toTopic(topic_attr), topic_attr.QOS,
+        [moved_data_cb = std::move(data_cb),
+         type_name = schemaTypeName<typename TopicAttr::DataType>()](const Sample& sample) {
+          if (not moved_data_cb) {
+            return;
+          }
+          if (not isSchemaCompatible(type_name, sample.info.type_name)) {
+            moved_data_cb(std::unexpected{ Error::SchemaMismatch }, sample.info);
+            return;
+          }
+          const auto view = DataView::create(sample.data);
+          if (not view) {
+            moved_data_cb(std::unexpected{ Error::DeserialisationFailed }, sample.info);
+            return;
+          }
+          moved_data_cb(*view, sample.info);
+        },
+        std::move(match_cb), executor) {
+}
+}  // namespace grape::ipc
@@ -15,6 +15,7 @@ void bindSubscriber(const nanobind::module_& module) {
   // Bind SampleInfo struct
   nanobind::class_<SampleInfo>(module, "SampleInfo")
       .def_ro("publish_time", &SampleInfo::publish_time, "Publication timestamp")
+      .def_ro("sequence", &SampleInfo::sequence, "Publisher sequence number")
       .def_ro("publisher", &SampleInfo::publisher, "Publisher ID")
       .def_ro("type_name", &SampleInfo::type_name, "Data type name");
 
@@ -0,0 +1,106 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#include "batcher.h"
+
+#include <tuple>
+#include <utility>
+
+namespace grape::ipc {
+
+//-------------------------------------------------------------------------------------------------
+Batcher::Batcher(const BatchConfig& config, SendFunction&& send)
+  : config_(config), send_(std::move(send)) {
+  frame_.reserve(config_.max_bytes);
+  if (config_.max_delay > std::chrono::nanoseconds::zero()) {
+    delay_thread_ = std::thread([this] { enforceDelay(); });
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+Batcher::~Batcher() {
+  {
+    const auto lock = std::lock_guard(mutex_);
+    stop_ = true;
+    std::ignore = flushLocked();  // no caller to report to; SendFunction accounts for failure
+  }
+  cv_.notify_all();
+  if (delay_thread_.joinable()) {
+    delay_thread_.join();
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+auto Batcher::add(std::size_t size, const RawPublisher::WriteCallback& writer,
+                  std::int64_t publish_time_ns, std::uint64_t sequence)
+    -> std::expected<void, Error> {
+  const auto lock = std::lock_guard(mutex_);
+  const auto record_size = sizeof(BatchRecordHeader) + size;
+
+  // make room by sending what we have, rather than exceed the size limit. That batch holds none of
+  // this message, so its failure is left to SendFunction rather than reported as this one's
+  if ((message_count_ > 0) && (frame_.size() + record_size > config_.max_bytes)) {
+    std::ignore = flushLocked();
+  }
+
+  const auto header = BatchRecordHeader{
+    .publish_time_ns = publish_time_ns, .sequence = sequence, .size = size
+  };
+  const auto offset = frame_.size();
+  frame_.resize(offset + record_size);
+  std::memcpy(&frame_.at(offset), &header, sizeof(header));
+  if (not writer(std::span{ frame_ }.subspan(offset + sizeof(header), size))) {
+    frame_.resize(offset);
+    return std::unexpected{ Error::SerialisationFailed };
+  }
+
+  ++message_count_;
+  if (message_count_ == 1) {
+    oldest_ = std::chrono::steady_clock::now();
+    cv_.notify_one();
+  }
+  if ((message_count_ >= config_.max_messages) || (frame_.size() >= config_.max_bytes)) {
+    return flushLocked();
+  }
+  return {};
+}
+
+//-------------------------------------------------------------------------------------------------
+auto Batcher::flush() -> std::expected<void, Error> {
+  const auto lock = std::lock_guard(mutex_);
+  return flushLocked();
+}
+
+//-------------------------------------------------------------------------------------------------
+auto Batcher::flushLocked() -> std::expected<void, Error> {
+  if (message_count_ == 0) {
+    return {};
+  }
+  const auto is_sent = send_(frame_);
+  frame_.clear();  // retains capacity for the next batch
+  message_count_ = 0;
+  if (not is_sent) {
+    return std::unexpected{ Error::PublishFailed };
+  }
+  return {};
+}
+
+//-------------------------------------------------------------------------------------------------
+void Batcher::enforceDelay() {
+  auto lock = std::unique_lock(mutex_);
+  while (not stop_) {
+    if (message_count_ == 0) {
+      cv_.wait(lock, [this] { return stop_ || (message_count_ > 0); });
+      continue;
+    }
+    const auto deadline = oldest_ + config_.max_delay;
+    cv_.wait_until(lock, deadline, [this] { return stop_; });
+    // the batch may have been sent and another started while waiting
+    if ((message_count_ > 0) && (std::chrono::steady_clock::now() >= oldest_ + config_.max_delay)) {
+      std::ignore = flushLocked();  // no caller to report to; SendFunction accounts for failure
+    }
+  }
+}
+
+}  // namespace grape::ipc
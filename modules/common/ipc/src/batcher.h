@@ -0,0 +1,120 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "grape/ipc/batching.h"
+#include "grape/ipc/error.h"
+#include "grape/ipc/raw_publisher.h"
+
+namespace grape::ipc {
+
+/// Encoding announced by publishers that send batches, so subscribers know to unbatch frames
+constexpr auto BATCH_ENCODING = std::string_view{ "grape-batch" };
+
+/// Encoding announced by unbatched publishers, whose messages are each sent as a frame of a single
+/// record. Replaces "grape", under which earlier versions sent messages without a record header,
+/// so that subscribers can ignore messages from such peers rather than misparse them
+constexpr auto FRAMED_ENCODING = std::string_view{ "grape-framed" };
+
+/// @return true if messages announced with encoding are sent as frames of records
+[[nodiscard]] constexpr auto isFramedEncoding(std::string_view encoding) -> bool {
+  return (encoding == FRAMED_ENCODING) || (encoding == BATCH_ENCODING);
+}
+
+/// Precedes each message in a frame sent through the transport. Unbatched messages are sent as
+/// frames of a single record
+struct BatchRecordHeader {
+  std::int64_t publish_time_ns;
+  std::uint64_t sequence;
+  std::uint64_t size;
+};
+
+//-------------------------------------------------------------------------------------------------
+/// Invoke function on every message in a frame, in the order they were published
+/// @param frame Frame, as sent by a Batcher or by an unbatched RawPublisher
+/// @param fn Function taking a BatchRecordHeader and the message bytes
+/// @return false if frame is malformed. Messages up to the malformed one are still processed
+template <typename Fn>
+auto forEachBatchRecord(std::span<const std::byte> frame, Fn&& fn) -> bool {
+  while (not frame.empty()) {
+    auto header = BatchRecordHeader{};
+    if (frame.size_bytes() < sizeof(header)) {
+      return false;
+    }
+    std::memcpy(&header, frame.data(), sizeof(header));
+    frame = frame.subspan(sizeof(header));
+    if (frame.size_bytes() < header.size) {
+      return false;
+    }
+    fn(header, frame.first(header.size));
+    frame = frame.subspan(header.size);
+  }
+  return true;
+}
+
+//=================================================================================================
+/// Coalesces messages into batch frames, sending each frame once a limit set in BatchConfig is
+/// reached. A background thread enforces the delay limit.
+class Batcher {
+public:
+  /// Signature of function that sends a frame through the transport. Failures to send a batch other
+  /// than one just completed by add() or flush() are not reported to any caller, so this function
+  /// is expected to account for them, e.g. in endpoint statistics
+  using SendFunction = std::function<bool(std::span<const std::byte>)>;
+
+  Batcher(const BatchConfig& config, SendFunction&& send);
+
+  /// Append a message to the current batch, sending the batch if a limit is reached
+  /// @param size Exact size of the message in bytes
+  /// @param writer Writes the message in-place, as for RawPublisher::publish(size, writer)
+  /// @param publish_time_ns Publish time of message, in nanoseconds since WallClock epoch
+  /// @param sequence Sequence number of message
+  /// @return nothing if the message was queued or sent, Error::SerialisationFailed if writer
+  /// failed, or Error::PublishFailed if the batch completed by this message could not be sent. A
+  /// failure to send the previous batch, to make room for this message, is left to SendFunction
+  [[nodiscard]] auto add(std::size_t size, const RawPublisher::WriteCallback& writer,
+                         std::int64_t publish_time_ns, std::uint64_t sequence)
+      -> std::expected<void, Error>;
+
+  /// Send the current batch, if not empty
+  [[nodiscard]] auto flush() -> std::expected<void, Error>;
+
+  /// Sends the current batch and stops the background thread
+  ~Batcher();
+
+  Batcher(const Batcher&) = delete;
+  Batcher(Batcher&&) = delete;
+  auto operator=(const Batcher&) = delete;
+  auto operator=(Batcher&&) = delete;
+
+private:
+  [[nodiscard]] auto flushLocked() -> std::expected<void, Error>;
+  void enforceDelay();
+
+  BatchConfig config_;
+  SendFunction send_;
+  std::vector<std::byte> frame_;
+  std::size_t message_count_{ 0 };
+  std::chrono::steady_clock::time_point oldest_;
+  bool stop_{ false };
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::thread delay_thread_;
+};
+
+}  // namespace grape::ipc
@@ -4,13 +4,20 @@
 
 #include "grape/ipc/discovery.h"
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
 #include <set>
 #include <tuple>
+#include <utility>
 
 #include <ecal/pubsub/types.h>
 #include <ecal/registration.h>
 #include <ecal/types.h>
 
+#include "grape/exception.h"
+#include "grape/ipc/session.h"
+
 namespace {
 //-------------------------------------------------------------------------------------------------
 auto toEndpointInfo(const eCAL::STopicId& id, const eCAL::SDataTypeInformation& type_info)
@@ -19,6 +26,13 @@ auto toEndpointInfo(const eCAL::STopicId& id, const eCAL::SDataTypeInformation&
            .type_name = type_info.name,
            .encoding = type_info.encoding };
 }
+
+//-------------------------------------------------------------------------------------------------
+auto endpointsOf(grape::ipc::Endpoints& endpoints, grape::ipc::DiscoveryEvent::Role role)
+    -> std::vector<grape::ipc::EndpointInfo>& {
+  return (role == grape::ipc::DiscoveryEvent::Role::Publisher) ? endpoints.publishers
+                                                               : endpoints.subscribers;
+}
 }  // namespace
 
 namespace grape::ipc {
@@ -45,4 +59,132 @@ auto discover() -> std::unordered_map<TopicName, Endpoints> {
   return topics;
 }
 
+//=================================================================================================
+struct DiscoveryCache::Impl {
+  using Role = DiscoveryEvent::Role;
+  using Kind = DiscoveryEvent::Kind;
+
+  /// Apply a registration event to the graph and notify the user
+  void update(Role role, const eCAL::STopicId& id, Kind kind) {
+    auto event =
+        DiscoveryEvent{ .kind = kind, .role = role, .topic = id.topic_name, .endpoint = {} };
+    if (kind == Kind::Added) {
+      auto type_info = eCAL::SDataTypeInformation{};
+      if (role == Role::Publisher) {
+        std::ignore = eCAL::Registration::GetPublisherInfo(id, type_info);
+      } else {
+        std::ignore = eCAL::Registration::GetSubscriberInfo(id, type_info);
+      }
+      event.endpoint = toEndpointInfo(id, type_info);
+    } else {
+      event.endpoint.entity_id = { .host = id.topic_id.host_name, .id = id.topic_id.entity_id };
+    }
+
+    const auto notify_lock = std::lock_guard(notify_mutex);
+    {
+      const auto lock = std::lock_guard(graph_mutex);
+      if (not apply(event)) {
+        return;
+      }
+      snapshot = nullptr;
+      version.fetch_add(1U, std::memory_order_relaxed);
+    }
+    if (event_cb != nullptr) {
+      event_cb(event);
+    }
+  }
+
+  /// @return false if event does not change the graph. Fills in details of removed endpoints
+  auto apply(DiscoveryEvent& event) -> bool {
+    const auto is_same = [&event](const EndpointInfo& ep) {
+      return ep.entity_id.id == event.endpoint.entity_id.id;
+    };
+    if (event.kind == Kind::Added) {
+      auto& endpoints = endpointsOf(graph[event.topic], event.role);
+      if (std::ranges::any_of(endpoints, is_same)) {
+        return false;  // already known, e.g. registered while populating initially
+      }
+      endpoints.push_back(event.endpoint);
+      return true;
+    }
+    const auto topic_it = graph.find(event.topic);
+    if (topic_it == graph.end()) {
+      return false;
+    }
+    auto& endpoints = endpointsOf(topic_it->second, event.role);
+    const auto it = std::ranges::find_if(endpoints, is_same);
+    if (it == endpoints.end()) {
+      return false;
+    }
+    event.endpoint = std::move(*it);
+    endpoints.erase(it);
+    if (topic_it->second.publishers.empty() && topic_it->second.subscribers.empty()) {
+      graph.erase(topic_it);
+    }
+    return true;
+  }
+
+  EventCallback event_cb;
+  std::mutex notify_mutex;        // serialises updates along with their notifications
+  mutable std::mutex graph_mutex;  // guards graph and snapshot
+  Graph graph;
+  mutable std::shared_ptr<const Graph> snapshot;  // rebuilt on demand after a change
+  std::atomic_uint64_t version{ 0 };
+  eCAL::Registration::CallbackToken pub_token{};
+  eCAL::Registration::CallbackToken sub_token{};
+};
+
+//-------------------------------------------------------------------------------------------------
+DiscoveryCache::DiscoveryCache(EventCallback&& event_cb) : impl_(std::make_unique<Impl>()) {
+  if (not ok()) {
+    panic("Not initialised");
+  }
+  using Role = DiscoveryEvent::Role;
+  using Kind = DiscoveryEvent::Kind;
+  using RegistrationEventType = eCAL::Registration::RegistrationEventType;
+  impl_->event_cb = std::move(event_cb);
+
+  // subscribe to changes before taking stock, so that none are missed in between
+  const auto event_handler = [impl = impl_.get()](Role role) {
+    return [impl, role](const eCAL::STopicId& id, RegistrationEventType type) {
+      impl->update(role, id,
+                   (type == RegistrationEventType::new_entity) ? Kind::Added : Kind::Removed);
+    };
+  };
+  impl_->pub_token = eCAL::Registration::AddPublisherEventCallback(event_handler(Role::Publisher));
+  impl_->sub_token =
+      eCAL::Registration::AddSubscriberEventCallback(event_handler(Role::Subscriber));
+
+  auto pub_ids = std::set<eCAL::STopicId>{};
+  std::ignore = eCAL::Registration::GetPublisherIDs(pub_ids);
+  for (const auto& id : pub_ids) {
+    impl_->update(Role::Publisher, id, Kind::Added);
+  }
+  auto sub_ids = std::set<eCAL::STopicId>{};
+  std::ignore = eCAL::Registration::GetSubscriberIDs(sub_ids);
+  for (const auto& id : sub_ids) {
+    impl_->update(Role::Subscriber, id, Kind::Added);
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+DiscoveryCache::~DiscoveryCache() {
+  eCAL::Registration::RemPublisherEventCallback(impl_->pub_token);
+  eCAL::Registration::RemSubscriberEventCallback(impl_->sub_token);
+}
+
+//-------------------------------------------------------------------------------------------------
+auto DiscoveryCache::snapshot() const -> std::shared_ptr<const Graph> {
+  const auto lock = std::lock_guard(impl_->graph_mutex);
+  if (impl_->snapshot == nullptr) {
+    impl_->snapshot = std::make_shared<const Graph>(impl_->graph);
+  }
+  return impl_->snapshot;
+}
+
+//-------------------------------------------------------------------------------------------------
+auto DiscoveryCache::version() const -> std::uint64_t {
+  return impl_->version.load(std::memory_order_relaxed);
+}
+
 }  // namespace grape::ipc
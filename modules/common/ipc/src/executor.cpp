@@ -0,0 +1,95 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#include "executor.h"
+
+#include <algorithm>
+#include <optional>
+#include <utility>
+
+namespace grape::ipc {
+
+//-------------------------------------------------------------------------------------------------
+Executor::Executor(const ExecutorConfig& config, RawSubscriber::DataCallback&& callback)
+  : config_(config), callback_(std::move(callback)), queue_(std::max(config.queue_depth, 1UZ)) {
+  config_.queue_depth = std::max(config_.queue_depth, 1UZ);
+  const auto num_workers = std::max(config_.num_workers, 1UZ);
+  workers_.reserve(num_workers);
+  for (auto i = 0UZ; i < num_workers; ++i) {
+    workers_.emplace_back([this] { work(); });
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+Executor::~Executor() {
+  {
+    const auto lock = std::lock_guard(mutex_);
+    stop_ = true;
+  }
+  data_cv_.notify_all();
+  space_cv_.notify_all();
+  for (auto& worker : workers_) {
+    worker.join();
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+void Executor::post(const Sample& sample) {
+  auto queued = QueuedSample{ .data = { sample.data.begin(), sample.data.end() },
+                              .info = sample.info };
+  {
+    // Popping from the queue is not safe concurrently with workers, and KeepAll waits for space
+    // signalled by workers. All pushes are done under lock for these reasons.
+    auto lock = std::unique_lock(mutex_);
+    if (config_.policy == ExecutorConfig::Policy::KeepLatest) {
+      while (queue_.tryPop().has_value()) {
+        drop_count_.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+    while (not queue_.tryPush(std::move(queued))) {
+      if (config_.policy == ExecutorConfig::Policy::KeepAll) {
+        space_cv_.wait(lock, [this] { return stop_ || (queue_.count() < config_.queue_depth); });
+        if (stop_) {
+          return;
+        }
+        continue;
+      }
+      if (queue_.tryPop().has_value()) {
+        drop_count_.fetch_add(1, std::memory_order_relaxed);
+      }
+    }
+  }
+  data_cv_.notify_one();
+}
+
+//-------------------------------------------------------------------------------------------------
+void Executor::work() {
+  while (true) {
+    auto queued = std::optional<QueuedSample>{};
+    {
+      auto lock = std::unique_lock(mutex_);
+      data_cv_.wait(lock, [this] { return stop_ || (queue_.count() > 0); });
+      if (stop_) {
+        return;
+      }
+      queued = queue_.tryPop();
+    }
+    space_cv_.notify_one();
+    if (queued.has_value() && callback_ != nullptr) {
+      callback_({ .data = queued->data, .info = queued->info });
+    }
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+auto Executor::queueDepth() const -> std::size_t {
+  return queue_.count();
+}
+
+//-------------------------------------------------------------------------------------------------
+auto Executor::dropCount() const -> std::uint64_t {
+  return drop_count_.load(std::memory_order_relaxed);
+}
+
+}  // namespace grape::ipc
@@ -0,0 +1,64 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "grape/ipc/executor.h"
+#include "grape/ipc/raw_subscriber.h"
+#include "grape/realtime/mpsc_queue.h"
+
+namespace grape::ipc {
+
+//=================================================================================================
+/// Queues samples received by a subscriber and invokes its data callback from a pool of worker
+/// threads. See ExecutorConfig.
+class Executor {
+public:
+  Executor(const ExecutorConfig& config, RawSubscriber::DataCallback&& callback);
+
+  /// Copy sample into the queue for delivery by a worker. Can be called concurrently.
+  void post(const Sample& sample);
+
+  /// @return Number of samples waiting to be delivered
+  [[nodiscard]] auto queueDepth() const -> std::size_t;
+
+  /// @return Number of samples dropped so far due to the queueing policy
+  [[nodiscard]] auto dropCount() const -> std::uint64_t;
+
+  /// Stops workers. Samples still in the queue are discarded.
+  ~Executor();
+
+  Executor(const Executor&) = delete;
+  Executor(Executor&&) = delete;
+  auto operator=(const Executor&) = delete;
+  auto operator=(Executor&&) = delete;
+
+private:
+  struct QueuedSample {
+    std::vector<std::byte> data;
+    SampleInfo info;
+  };
+
+  void work();
+
+  ExecutorConfig config_;
+  RawSubscriber::DataCallback callback_;
+  realtime::MPSCQueue<QueuedSample> queue_;
+  std::atomic_uint64_t drop_count_{ 0 };
+  bool stop_{ false };
+  std::mutex mutex_;  // serialises queue operations that are not safe concurrently
+  std::condition_variable data_cv_;
+  std::condition_variable space_cv_;
+  std::vector<std::thread> workers_;
+};
+
+}  // namespace grape::ipc
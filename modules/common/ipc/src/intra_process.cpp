@@ -0,0 +1,109 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#include "intra_process.h"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::atomic_bool s_intra_process_delivery = true;
+}  // namespace
+
+namespace grape::ipc {
+
+//-------------------------------------------------------------------------------------------------
+void setIntraProcessDelivery(bool is_enabled) {
+  s_intra_process_delivery.store(is_enabled, std::memory_order_relaxed);
+}
+
+//-------------------------------------------------------------------------------------------------
+auto isIntraProcessDelivery() -> bool {
+  return s_intra_process_delivery.load(std::memory_order_relaxed);
+}
+
+//-------------------------------------------------------------------------------------------------
+auto LocalChannel::get(const std::string& topic_name) -> std::shared_ptr<LocalChannel> {
+  if (not isIntraProcessDelivery()) {
+    return std::make_shared<LocalChannel>();
+  }
+  static auto mutex = std::mutex{};
+  static auto channels = std::unordered_map<std::string, std::weak_ptr<LocalChannel>>{};
+
+  const auto lock = std::lock_guard(mutex);
+  const auto it = channels.find(topic_name);
+  if (it != channels.end()) {
+    if (auto channel = it->second.lock(); channel != nullptr) {
+      return channel;
+    }
+  }
+  // channels of topics no longer in use are only cleaned up here, when a new one is needed
+  std::erase_if(channels, [](const auto& item) { return item.second.expired(); });
+  auto channel = std::make_shared<LocalChannel>();
+  channels.emplace(topic_name, channel);
+  return channel;
+}
+
+//-------------------------------------------------------------------------------------------------
+void LocalChannel::add(const std::shared_ptr<LocalSubscriber>& subscriber) {
+  const auto lock = std::lock_guard(mutex_);
+  auto subscribers = std::make_shared<Subscribers>(*subscribers_);
+  subscribers->push_back(subscriber);
+  count_.store(subscribers->size(), std::memory_order_relaxed);
+  subscribers_ = std::move(subscribers);
+}
+
+//-------------------------------------------------------------------------------------------------
+void LocalChannel::remove(const std::shared_ptr<LocalSubscriber>& subscriber) {
+  {
+    const auto lock = std::lock_guard(mutex_);
+    auto subscribers = std::make_shared<Subscribers>(*subscribers_);
+    std::erase(*subscribers, subscriber);
+    count_.store(subscribers->size(), std::memory_order_relaxed);
+    subscribers_ = std::move(subscribers);
+  }
+
+  // Publishers may still hold a snapshot that includes the subscriber. Pairs with Delivery, so
+  // that either a delivery sees the subscriber inactive or we see the delivery in progress
+  subscriber->is_active.store(false, std::memory_order_seq_cst);
+  auto deliveries = subscriber->deliveries.load(std::memory_order_seq_cst);
+  while (deliveries != 0U) {
+    subscriber->deliveries.wait(deliveries, std::memory_order_seq_cst);
+    deliveries = subscriber->deliveries.load(std::memory_order_seq_cst);
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+auto LocalChannel::empty() const -> bool {
+  return count_.load(std::memory_order_relaxed) == 0U;
+}
+
+//-------------------------------------------------------------------------------------------------
+auto LocalChannel::snapshot() const -> std::shared_ptr<const Subscribers> {
+  const auto lock = std::lock_guard(mutex_);
+  return subscribers_;
+}
+
+//-------------------------------------------------------------------------------------------------
+LocalChannel::Delivery::Delivery(LocalSubscriber& subscriber) : subscriber_(subscriber) {
+  subscriber_.deliveries.fetch_add(1U, std::memory_order_seq_cst);
+}
+
+//-------------------------------------------------------------------------------------------------
+LocalChannel::Delivery::~Delivery() {
+  const auto remaining = subscriber_.deliveries.fetch_sub(1U, std::memory_order_seq_cst) - 1U;
+  if ((remaining == 0U) && (not subscriber_.is_active.load(std::memory_order_seq_cst))) {
+    subscriber_.deliveries.notify_all();  // wake up remove()
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+auto LocalChannel::Delivery::isAllowed() const -> bool {
+  return subscriber_.is_active.load(std::memory_order_seq_cst);
+}
+
+}  // namespace grape::ipc
@@ -0,0 +1,109 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "grape/ipc/raw_subscriber.h"
+
+namespace grape::ipc {
+
+/// Enables or disables direct delivery between endpoints in this process, for endpoints created
+/// afterwards. Set from Config::intra_process by init()
+void setIntraProcessDelivery(bool is_enabled);
+
+/// @return true if endpoints in this process deliver samples directly to each other
+[[nodiscard]] auto isIntraProcessDelivery() -> bool;
+
+//=================================================================================================
+/// A subscriber as seen by publishers on the same topic in this process
+struct LocalSubscriber {
+  /// Signature of callback on a typed object, with its serialised size for statistics
+  using ObjectCallback = std::function<void(const void*, std::size_t, const SampleInfo&)>;
+
+  RawSubscriber::DataCallback data_cb;  //!< Receives serialised samples
+  std::type_index type{ typeid(void) };  //!< Type of objects accepted by typed_cb, if set
+  ObjectCallback typed_cb;                //!< Receives typed objects without serialisation
+  std::atomic_bool is_active{ true };     //!< Cleared once removed from its channel
+  std::atomic_uint32_t deliveries{ 0 };   //!< Number of callbacks in progress
+};
+
+//=================================================================================================
+/// Subscribers on a topic in this process, to which publishers in this process deliver samples
+/// directly instead of via the transport. Shared by all endpoints on the topic in the process.
+///
+/// Callbacks are invoked without holding a lock on the channel, so they may publish on the topic,
+/// and create or destroy other subscribers on it.
+class LocalChannel {
+public:
+  /// @return The channel for a topic, created if this is the first endpoint on it. If
+  /// intra-process delivery is disabled, a new channel not shared with any other endpoint
+  [[nodiscard]] static auto get(const std::string& topic_name) -> std::shared_ptr<LocalChannel>;
+
+  void add(const std::shared_ptr<LocalSubscriber>& subscriber);
+
+  /// Removes a subscriber. Blocks until deliveries to it in progress on other threads complete, so
+  /// it must not be called from within the subscriber's own callbacks
+  void remove(const std::shared_ptr<LocalSubscriber>& subscriber);
+
+  /// @return true if there are no subscribers
+  [[nodiscard]] auto empty() const -> bool;
+
+  /// Invoke function on every subscriber that remains registered at the time of the call
+  template <typename Fn>
+  void forEach(Fn&& fn) const;
+
+private:
+  using Subscribers = std::vector<std::shared_ptr<LocalSubscriber>>;
+
+  //-----------------------------------------------------------------------------------------------
+  /// Marks a delivery to a subscriber as in progress for its lifetime
+  class Delivery {
+  public:
+    explicit Delivery(LocalSubscriber& subscriber);
+    ~Delivery();
+    Delivery(const Delivery&) = delete;
+    Delivery(Delivery&&) = delete;
+    auto operator=(const Delivery&) = delete;
+    auto operator=(Delivery&&) = delete;
+
+    /// @return false if the subscriber was removed and must not be invoked
+    [[nodiscard]] auto isAllowed() const -> bool;
+
+  private:
+    LocalSubscriber& subscriber_;
+  };
+
+  [[nodiscard]] auto snapshot() const -> std::shared_ptr<const Subscribers>;
+
+  mutable std::mutex mutex_;
+  std::shared_ptr<const Subscribers> subscribers_{ std::make_shared<const Subscribers>() };
+  std::atomic_size_t count_{ 0 };
+};
+
+//-------------------------------------------------------------------------------------------------
+template <typename Fn>
+void LocalChannel::forEach(Fn&& fn) const {
+  // iterate a snapshot of the subscriber list, which add() and remove() replace rather than modify
+  const auto subscribers = snapshot();
+  for (const auto& subscriber : *subscribers) {
+    const auto delivery = Delivery(*subscriber);
+    if (delivery.isAllowed()) {
+      fn(std::as_const(*subscriber));
+    }
+  }
+}
+
+}  // namespace grape::ipc
@@ -4,20 +4,33 @@
 
 #include "grape/ipc/raw_publisher.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 #include <functional>
+#include <memory>
+#include <optional>
+#include <span>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <ecal/config/configuration.h>
+#include <ecal/pubsub/payload_writer.h>
 #include <ecal/pubsub/publisher.h>
+#include <ecal/process.h>
 #include <ecal/pubsub/types.h>
 #include <ecal/types.h>
 
+#include "batcher.h"
 #include "default_config.h"
 #include "grape/exception.h"
+#include "grape/ipc/raw_subscriber.h"
 #include "grape/ipc/session.h"
 #include "grape/ipc/topic.h"
 #include "grape/wall_clock.h"
+#include "intra_process.h"
+#include "stats_counters.h"
 
 namespace eCAL::Publisher {
 struct Configuration;
@@ -32,7 +45,7 @@ void raiseMatchEvent(const eCAL::STopicId& topic_id, const eCAL::SPubEventCallba
     case eCAL::ePublisherEvent::none:
       [[fallthrough]];
     case eCAL::ePublisherEvent::dropped:
-      /* some subscribers missed one or more messages. Choosing to ignore this event! */
+      /* some subscribers missed one or more messages. Counted in endpoint statistics */
       return;
     case eCAL::ePublisherEvent::connected:
       match_cb({ .remote_entity = { .host = topic_id.topic_id.host_name,
@@ -51,6 +64,69 @@ void raiseMatchEvent(const eCAL::STopicId& topic_id, const eCAL::SPubEventCallba
   }
 }
 
+//-------------------------------------------------------------------------------------------------
+auto isInThisProcess(const eCAL::SEntityId& entity) -> bool {
+  static const auto this_process = eCAL::Process::GetProcessID();
+  static const auto this_host = eCAL::Process::GetHostName();
+  return (entity.process_id == this_process) && (entity.host_name == this_host);
+}
+
+//-------------------------------------------------------------------------------------------------
+// Keeps count of matched subscribers that must be reached via the transport
+void countRemoteSubscribers(const eCAL::STopicId& topic_id,
+                            const eCAL::SPubEventCallbackData& event_data,
+                            std::atomic_int64_t& count) {
+  if (grape::ipc::isIntraProcessDelivery() && isInThisProcess(topic_id.topic_id)) {
+    return;  // served directly via the local channel
+  }
+  if (event_data.event_type == eCAL::ePublisherEvent::connected) {
+    count.fetch_add(1, std::memory_order_relaxed);
+  } else if (event_data.event_type == eCAL::ePublisherEvent::disconnected) {
+    count.fetch_sub(1, std::memory_order_relaxed);
+  }
+}
+
+//=================================================================================================
+// Adapts a user-defined write function to eCAL's interface for writing payloads in-place, as a
+// frame of a single record
+class CallbackPayloadWriter : public eCAL::CPayloadWriter {
+public:
+  CallbackPayloadWriter(const grape::ipc::BatchRecordHeader& header,
+                        const grape::ipc::RawPublisher::WriteCallback& writer)
+    : header_(header), writer_(writer) {
+  }
+
+  auto WriteFull(void* buffer, std::size_t size) -> bool override {
+    const auto frame = std::span{ static_cast<std::byte*>(buffer), size };
+    std::memcpy(frame.data(), &header_, sizeof(header_));
+    is_write_failed_ = not writer_(frame.subspan(sizeof(header_)));
+    return not is_write_failed_;
+  }
+
+  auto GetSize() -> std::size_t override {
+    return sizeof(header_) + header_.size;
+  }
+
+  [[nodiscard]] auto isWriteFailed() const -> bool {
+    return is_write_failed_;
+  }
+
+private:
+  grape::ipc::BatchRecordHeader header_;
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-const-or-ref-data-members)
+  const grape::ipc::RawPublisher::WriteCallback& writer_;
+  bool is_write_failed_{ false };
+};
+
+//-------------------------------------------------------------------------------------------------
+// Write function that copies a message composed elsewhere
+auto copyFrom(std::span<const std::byte> bytes) -> grape::ipc::RawPublisher::WriteCallback {
+  return [bytes](std::span<std::byte> buffer) {
+    std::ranges::copy(bytes, buffer.begin());
+    return true;
+  };
+}
+
 }  // namespace
 
 namespace grape::ipc {
@@ -60,24 +136,110 @@ struct RawPublisher::Impl : public eCAL::CPublisher {
        const eCAL::PubEventCallbackT& event_cb, const eCAL::Publisher::Configuration& config)
     : eCAL::CPublisher(topic_name, type_info, event_cb, config) {
   }
+
+  [[nodiscard]] auto hasRemoteSubscribers() const -> bool {
+    return remote_subscriber_count->load(std::memory_order_relaxed) > 0;
+  }
+
+  /// @return meta information for samples delivered directly to subscribers in this process
+  [[nodiscard]] auto localSampleInfo(WallClock::TimePoint publish_time,
+                                     std::uint64_t sequence) const -> SampleInfo {
+    auto info = local_info;
+    info.publish_time = publish_time;
+    info.sequence = sequence;
+    return info;
+  }
+
+  /// Send a batch frame through the transport, counting a failure in stats
+  /// @return false if there are subscribers, but the frame could not be sent to them
+  [[nodiscard]] auto send(std::span<const std::byte> frame) -> bool {
+    const auto is_sent = Send(frame.data(), frame.size(), WallClock::toMicros(WallClock::now())) ||
+                         (GetSubscriberCount() == 0U);
+    if (not is_sent) {
+      stats->countSendFailure();
+    }
+    return is_sent;
+  }
+
+  /// Send message to subscribers in other processes, if any, written in-place by writer. The
+  /// message is preceded by a record header carrying its publish time and sequence number, whether
+  /// batched or not, so that remote subscribers see the same values as local ones.
+  [[nodiscard]] auto sendRemote(std::size_t size, const WriteCallback& writer,
+                                WallClock::TimePoint publish_time, std::uint64_t sequence)
+      -> std::expected<void, Error> {
+    if (not hasRemoteSubscribers()) {
+      return {};
+    }
+    const auto publish_time_ns = WallClock::toNanos(publish_time);
+    if (batcher != nullptr) {
+      return batcher->add(size, writer, publish_time_ns, sequence);
+    }
+    auto payload = CallbackPayloadWriter(
+        { .publish_time_ns = publish_time_ns, .sequence = sequence, .size = size }, writer);
+    // eCAL's own timestamp is in microseconds; subscribers read the precise one from the header
+    if (not Send(payload, WallClock::toMicros(publish_time))) {
+      if (payload.isWriteFailed()) {
+        return std::unexpected{ Error::SerialisationFailed };
+      }
+      if (GetSubscriberCount() > 0U) {
+        stats->countSendFailure();
+        return std::unexpected{ Error::PublishFailed };
+      }
+    }
+    return {};
+  }
+
+  std::shared_ptr<LocalChannel> channel;
+  SampleInfo local_info;  // publisher attributes of samples to local subscribers, set once
+  std::shared_ptr<std::atomic_int64_t> remote_subscriber_count;
+  std::atomic_uint64_t publish_count{ 0 };
+  std::shared_ptr<StatsCounters> stats;
+  std::unique_ptr<Batcher> batcher;  // destroyed first, sending what is left in the batch
 };
 
 //-------------------------------------------------------------------------------------------------
-RawPublisher::RawPublisher(const Topic& topic, MatchCallback&& match_cb) {
+RawPublisher::RawPublisher(const Topic& topic, MatchCallback&& match_cb,
+                           const std::optional<BatchConfig>& batching) {
   if (not ok()) {
     panic("Not initialised");
   }
-  const auto event_cb = [moved_match_cb = std::move(match_cb)](
+  auto remote_subscriber_count = std::make_shared<std::atomic_int64_t>(0);
+  auto stats = std::make_shared<StatsCounters>();
+  const auto event_cb = [moved_match_cb = std::move(match_cb), remote_subscriber_count, stats](
                             const eCAL::STopicId& topic_id,
                             const eCAL::SPubEventCallbackData& event_data) -> void {
+    countRemoteSubscribers(topic_id, event_data, *remote_subscriber_count);
+    if (event_data.event_type == eCAL::ePublisherEvent::dropped) {
+      stats->countDrop();
+    }
     if (moved_match_cb != nullptr) {
       raiseMatchEvent(topic_id, event_data, moved_match_cb);
     }
   };
   const auto type_info =
-      eCAL::SDataTypeInformation{ .name = topic.type_name, .encoding = "grape", .descriptor = "" };
+      eCAL::SDataTypeInformation{ .name = topic.type_name,
+                                  .encoding = std::string{ batching ? BATCH_ENCODING
+                                                                   : FRAMED_ENCODING },
+                                  .descriptor = "" };
   impl_ = std::make_unique<RawPublisher::Impl>(topic.name, type_info, event_cb,
                                                defaultConfig().publisher);
+  impl_->remote_subscriber_count = std::move(remote_subscriber_count);
+  impl_->channel = LocalChannel::get(topic.name);
+  impl_->local_info = { .publish_time = {},
+                        .sequence = 0U,
+                        .publisher = { .host = eCAL::Process::GetHostName(), .id = id() },
+                        .type_name = topic.type_name };
+  impl_->stats = std::move(stats);
+  registerStats({ .role = EndpointStatsReport::Role::Publisher,
+                  .topic = topic.name,
+                  .endpoint = { .host = eCAL::Process::GetHostName(), .id = id() },
+                  .counters = impl_->stats });
+  if (batching.has_value()) {
+    impl_->batcher = std::make_unique<Batcher>(
+        *batching, [impl = impl_.get()](std::span<const std::byte> frame) -> bool {
+          return impl->send(frame);
+        });
+  }
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -88,12 +250,89 @@ RawPublisher::RawPublisher(RawPublisher&&) noexcept = default;
 
 //-------------------------------------------------------------------------------------------------
 auto RawPublisher::publish(std::span<const std::byte> bytes) const -> std::expected<void, Error> {
-  if (not impl_->Send(bytes.data(), bytes.size(), WallClock::toMicros(WallClock::now()))) {
-    if (impl_->GetSubscriberCount() > 0U) {
-      return std::unexpected{ Error::PublishFailed };
+  const auto publish_time = WallClock::now();
+  const auto sequence = impl_->publish_count.fetch_add(1U, std::memory_order_relaxed) + 1U;
+  impl_->stats->countMessage(bytes.size());
+  if (not impl_->channel->empty()) {
+    const auto sample =
+        Sample{ .data = bytes, .info = impl_->localSampleInfo(publish_time, sequence) };
+    impl_->channel->forEach([&sample](const LocalSubscriber& subscriber) {
+      if (subscriber.data_cb != nullptr) {
+        subscriber.data_cb(sample);
+      }
+    });
+  }
+  return impl_->sendRemote(bytes.size(), copyFrom(bytes), publish_time, sequence);
+}
+
+//-------------------------------------------------------------------------------------------------
+auto RawPublisher::publish(std::size_t size, const WriteCallback& writer) const
+    -> std::expected<void, Error> {
+  return publish(
+      nullptr, typeid(void), [size]() -> std::optional<std::size_t> { return size; }, writer);
+}
+
+//-------------------------------------------------------------------------------------------------
+auto RawPublisher::publish(const void* object, std::type_index type, const SizeCallback& size,
+                           const WriteCallback& writer) const -> std::expected<void, Error> {
+  const auto publish_time = WallClock::now();
+  const auto sequence = impl_->publish_count.fetch_add(1U, std::memory_order_relaxed) + 1U;
+  const auto accepts_object = [object, type](const LocalSubscriber& subscriber) {
+    return (object != nullptr) && (subscriber.typed_cb != nullptr) && (subscriber.type == type);
+  };
+
+  // Size is needed for statistics even if the message is not serialised. An object that cannot be
+  // serialised can still be handed over to subscribers in this process, and counts as 0 bytes
+  const auto message_size = size();
+
+  // hand the object over to subscribers in this process that can take it as is
+  auto info = std::optional<SampleInfo>{};
+  auto needs_local_message = false;
+  if (not impl_->channel->empty()) {
+    info = impl_->localSampleInfo(publish_time, sequence);
+    impl_->channel->forEach([&](const LocalSubscriber& subscriber) {
+      if (accepts_object(subscriber)) {
+        subscriber.typed_cb(object, message_size.value_or(0U), *info);
+      } else if (subscriber.data_cb != nullptr) {
+        needs_local_message = true;
+      }
+    });
+  }
+
+  if (not needs_local_message) {
+    // serialise, if at all, directly into transport memory
+    if (not impl_->hasRemoteSubscribers()) {
+      impl_->stats->countMessage(message_size.value_or(0U));
+      return {};
     }
+    if (not message_size) {
+      return std::unexpected{ Error::SerialisationFailed };
+    }
+    impl_->stats->countMessage(*message_size);
+    return impl_->sendRemote(*message_size, writer, publish_time, sequence);
+  }
+
+  // serialise once into a buffer shared by subscribers in this process and the transport
+  if (not message_size) {
+    return std::unexpected{ Error::SerialisationFailed };
+  }
+  auto buffer = std::vector<std::byte>(*message_size);
+  if (not writer(buffer)) {
+    return std::unexpected{ Error::SerialisationFailed };
   }
-  return {};
+  impl_->stats->countMessage(*message_size);
+  const auto sample = Sample{ .data = buffer, .info = *info };
+  impl_->channel->forEach([&](const LocalSubscriber& subscriber) {
+    if ((not accepts_object(subscriber)) && (subscriber.data_cb != nullptr)) {
+      subscriber.data_cb(sample);
+    }
+  });
+  return impl_->sendRemote(buffer.size(), copyFrom(buffer), publish_time, sequence);
+}
+
+//-------------------------------------------------------------------------------------------------
+auto RawPublisher::flush() const -> std::expected<void, Error> {
+  return (impl_->batcher != nullptr) ? impl_->batcher->flush() : std::expected<void, Error>{};
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -106,4 +345,9 @@ auto RawPublisher::id() const -> std::uint64_t {
   return impl_->GetTopicId().topic_id.entity_id;
 }
 
+//-------------------------------------------------------------------------------------------------
+auto RawPublisher::stats() const -> EndpointStats {
+  return impl_->stats->snapshot();
+}
+
 }  // namespace grape::ipc
@@ -4,15 +4,29 @@
 
 #include "grape/ipc/raw_subscriber.h"
 
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <tuple>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <ecal/config/configuration.h>
 #include <ecal/config/subscriber.h>
+#include <ecal/process.h>
 #include <ecal/pubsub/subscriber.h>
 #include <ecal/pubsub/types.h>
 #include <ecal/types.h>
 
+#include "batcher.h"
 #include "default_config.h"
+#include "executor.h"
+#include "intra_process.h"
+#include "stats_counters.h"
 #include "grape/exception.h"
 #include "grape/ipc/qos.h"
 #include "grape/ipc/session.h"
@@ -27,7 +41,7 @@ void raiseMatchEvent(const eCAL::STopicId& topic_id, const eCAL::SSubEventCallba
     case eCAL::eSubscriberEvent::none:
       [[fallthrough]];
     case eCAL::eSubscriberEvent::dropped:
-      /* A message was dropped. Choosing to ignore this event! */
+      /* A message was dropped. Counted in endpoint statistics; not a match event */
       return;
     case eCAL::eSubscriberEvent::connected:
       match_cb({ .remote_entity = { .host = topic_id.topic_id.host_name,
@@ -62,6 +76,99 @@ auto createConfig(grape::ipc::QoS qos) -> eCAL::Subscriber::Configuration {
   return config;
 }
 
+//=================================================================================================
+// Counts missed and repeated samples from the sequence numbers of each publisher's samples.
+// update() is only called from the receive callback, which eCAL invokes for one sample at a time,
+// so per-publisher state is owned by it and needs no lock. Publishers that disconnect are retired
+// from the event thread, and their state is dropped on the next update.
+class SequenceTracker {
+public:
+  void update(std::uint64_t publisher_id, std::uint64_t sequence) {
+    if (has_retired_.load(std::memory_order_acquire)) {
+      dropRetired();
+    }
+    const auto [it, is_new_publisher] = last_sequence_.try_emplace(publisher_id, sequence);
+    if (is_new_publisher) {
+      return;  // samples published before we started listening are not counted as missed
+    }
+    auto& last = it->second;
+    if (sequence <= last) {
+      duplicate_count_.fetch_add(1U, std::memory_order_relaxed);
+      return;
+    }
+    gap_count_.fetch_add(sequence - last - 1U, std::memory_order_relaxed);
+    last = sequence;
+  }
+
+  [[nodiscard]] auto gapCount() const -> std::uint64_t {
+    return gap_count_.load(std::memory_order_relaxed);
+  }
+
+  [[nodiscard]] auto duplicateCount() const -> std::uint64_t {
+    return duplicate_count_.load(std::memory_order_relaxed);
+  }
+
+  /// Forget the publisher, once it has disconnected
+  void retire(std::uint64_t publisher_id) {
+    const auto lock = std::lock_guard(retired_mutex_);
+    retired_.push_back(publisher_id);
+    has_retired_.store(true, std::memory_order_release);
+  }
+
+private:
+  void dropRetired() {
+    const auto lock = std::lock_guard(retired_mutex_);
+    for (const auto publisher_id : retired_) {
+      last_sequence_.erase(publisher_id);
+    }
+    retired_.clear();
+    has_retired_.store(false, std::memory_order_relaxed);
+  }
+
+  std::unordered_map<std::uint64_t, std::uint64_t> last_sequence_;  // owned by update()
+  std::mutex retired_mutex_;
+  std::vector<std::uint64_t> retired_;
+  std::atomic_bool has_retired_{ false };
+  std::atomic_uint64_t gap_count_{ 0 };
+  std::atomic_uint64_t duplicate_count_{ 0 };
+};
+
+//-------------------------------------------------------------------------------------------------
+// Wraps data callback to count deliveries, their latency and time spent in the callback
+auto countDeliveries(grape::ipc::RawSubscriber::DataCallback&& data_cb,
+                     std::shared_ptr<grape::ipc::StatsCounters> stats)
+    -> grape::ipc::RawSubscriber::DataCallback {
+  if (data_cb == nullptr) {
+    return nullptr;
+  }
+  return [cb = std::move(data_cb), stats = std::move(stats)](const grape::ipc::Sample& sample) {
+    const auto start = std::chrono::steady_clock::now();
+    stats->countLatency(grape::WallClock::now() - sample.info.publish_time);
+    cb(sample);
+    stats->countCallbackTime(std::chrono::steady_clock::now() - start);
+    stats->countMessage(sample.data.size());
+  };
+}
+
+//-------------------------------------------------------------------------------------------------
+// As above, for objects handed over without serialisation. Counts their serialised size, as
+// reported by the publisher, so that byte counts do not depend on where the publisher is
+auto countObjectDeliveries(grape::ipc::RawSubscriber::TypedCallback&& typed_cb,
+                           std::shared_ptr<grape::ipc::StatsCounters> stats)
+    -> grape::ipc::LocalSubscriber::ObjectCallback {
+  if (typed_cb == nullptr) {
+    return nullptr;
+  }
+  return [cb = std::move(typed_cb), stats = std::move(stats)](
+             const void* object, std::size_t size, const grape::ipc::SampleInfo& info) {
+    const auto start = std::chrono::steady_clock::now();
+    stats->countLatency(grape::WallClock::now() - info.publish_time);
+    cb(object, info);
+    stats->countCallbackTime(std::chrono::steady_clock::now() - start);
+    stats->countMessage(size);
+  };
+}
+
 }  // namespace
 
 namespace grape::ipc {
@@ -71,50 +178,132 @@ struct RawSubscriber::Impl : public eCAL::CSubscriber {
        const eCAL::SubEventCallbackT& event_cb, const eCAL::Subscriber::Configuration& config)
     : eCAL::CSubscriber(topic_name, type_info, event_cb, config) {
   }
+
+  ~Impl() override {
+    // ensure publishers and the receive thread are done with the executor before it is destroyed
+    if (channel != nullptr) {
+      channel->remove(local);
+    }
+    RemoveReceiveCallback();
+  }
+
+  Impl(const Impl&) = delete;
+  Impl(Impl&&) = delete;
+  auto operator=(const Impl&) = delete;
+  auto operator=(Impl&&) = delete;
+
+  std::unique_ptr<Executor> executor;
+  std::shared_ptr<SequenceTracker> sequence_tracker;
+  std::shared_ptr<LocalSubscriber> local{ std::make_shared<LocalSubscriber>() };
+  std::shared_ptr<LocalChannel> channel;
+  std::shared_ptr<StatsCounters> stats;
 };
 
 //-------------------------------------------------------------------------------------------------
 RawSubscriber::RawSubscriber(const Topic& topic, QoS qos, RawSubscriber::DataCallback&& data_cb,
-                             MatchCallback&& match_cb) {
+                             MatchCallback&& match_cb,
+                             const std::optional<ExecutorConfig>& executor)
+  : RawSubscriber(topic, qos, std::move(data_cb), std::move(match_cb), executor, typeid(void),
+                  nullptr) {
+}
+
+//-------------------------------------------------------------------------------------------------
+RawSubscriber::RawSubscriber(const Topic& topic, QoS qos, DataCallback&& data_cb,
+                             MatchCallback&& match_cb,
+                             const std::optional<ExecutorConfig>& executor, std::type_index type,
+                             TypedCallback&& typed_cb) {
   if (not ok()) {
     panic("Not initialised");
   }
 
-  const auto event_cb = [moved_match_cb = std::move(match_cb)](
+  auto stats = std::make_shared<StatsCounters>();
+  auto sequence_tracker = std::make_shared<SequenceTracker>();
+  const auto event_cb = [moved_match_cb = std::move(match_cb), stats, sequence_tracker](
                             const eCAL::STopicId& topic_id,
                             const eCAL::SSubEventCallbackData& event_data) -> void {
+    if (event_data.event_type == eCAL::eSubscriberEvent::dropped) {
+      stats->countDrop();
+    }
+    if (event_data.event_type == eCAL::eSubscriberEvent::disconnected) {
+      sequence_tracker->retire(topic_id.topic_id.entity_id);
+    }
     if (moved_match_cb != nullptr) {
       raiseMatchEvent(topic_id, event_data, moved_match_cb);
     }
   };
 
-  const auto type_info =
-      eCAL::SDataTypeInformation{ .name = topic.type_name, .encoding = "grape", .descriptor = "" };
+  const auto type_info = eCAL::SDataTypeInformation{
+    .name = topic.type_name, .encoding = std::string{ FRAMED_ENCODING }, .descriptor = ""
+  };
   impl_ = std::make_unique<RawSubscriber::Impl>(topic.name, type_info, event_cb, createConfig(qos));
+  impl_->stats = std::move(stats);
+  impl_->sequence_tracker = std::move(sequence_tracker);
+  registerStats({ .role = EndpointStatsReport::Role::Subscriber,
+                  .topic = topic.name,
+                  .endpoint = { .host = eCAL::Process::GetHostName(), .id = id() },
+                  .counters = impl_->stats });
+
+  // Count deliveries where they happen, whether on the receive thread or the executor's workers
+  data_cb = countDeliveries(std::move(data_cb), impl_->stats);
+  auto object_cb = countObjectDeliveries(std::move(typed_cb), impl_->stats);
+
+  // With an executor, the receive thread only queues samples for the executor to deliver
+  if (executor.has_value()) {
+    impl_->executor = std::make_unique<Executor>(*executor, std::move(data_cb));
+    data_cb = [exec = impl_->executor.get()](const Sample& sample) { exec->post(sample); };
+    object_cb = nullptr;
+  }
 
-  impl_->SetReceiveCallback([moved_data_cb = std::move(data_cb)](
+  // Publishers in this process deliver directly to subscribers registered on the local channel
+  impl_->local->data_cb = std::move(data_cb);
+  impl_->local->type = (object_cb != nullptr) ? type : typeid(void);
+  impl_->local->typed_cb = std::move(object_cb);
+  impl_->channel = LocalChannel::get(topic.name);
+  impl_->channel->add(impl_->local);
+
+  impl_->SetReceiveCallback([&data_cb = impl_->local->data_cb,
+                             tracker = impl_->sequence_tracker.get(),
+                             is_local_delivered = isIntraProcessDelivery(),
+                             this_process = eCAL::Process::GetProcessID(),
+                             this_host = eCAL::Process::GetHostName()](
                                 const eCAL::STopicId& tid, const eCAL::SDataTypeInformation& tinfo,
                                 const eCAL::SReceiveCallbackData& data) -> void {
-    if (moved_data_cb != nullptr) {
-      moved_data_cb({ .data = { static_cast<const std::byte*>(data.buffer), data.buffer_size },
-                      .info = { .publish_time = WallClock::fromMicros(data.send_timestamp),
-                                .publisher = {
-                                    .host = tid.topic_id.host_name,
-                                    .id = tid.topic_id.entity_id,},
-                                    .type_name = tinfo.name,
-                                }, });
+    if (is_local_delivered && (tid.topic_id.process_id == this_process) &&
+        (tid.topic_id.host_name == this_host)) {
+      return;  // already delivered directly via the local channel
+    }
+    if (not isFramedEncoding(tinfo.encoding)) {
+      return;  // not sent by a compatible publisher; would be misparsed
     }
+    const auto bytes = std::span{ static_cast<const std::byte*>(data.buffer), data.buffer_size };
+    auto info = SampleInfo{ .publish_time = {},
+                            .sequence = 0U,
+                            .publisher = { .host = tid.topic_id.host_name,
+                                           .id = tid.topic_id.entity_id },
+                            .type_name = tinfo.name };
+    // every message, batched or not, carries the publish time and sequence number assigned by
+    // its publisher in a record header
+    std::ignore = forEachBatchRecord(
+        bytes, [&](const BatchRecordHeader& header, std::span<const std::byte> message) {
+          info.publish_time = WallClock::fromNanos(header.publish_time_ns);
+          info.sequence = header.sequence;
+          tracker->update(info.publisher.id, info.sequence);
+          if (data_cb != nullptr) {
+            data_cb({ .data = message, .info = info });
+          }
+        });
   });
 }
 
 //-------------------------------------------------------------------------------------------------
 RawSubscriber::RawSubscriber(const std::string& topic_name, QoS qos, DataCallback&& data_cb,
-                             MatchCallback&& match_cb)
+                             MatchCallback&& match_cb,
+                             const std::optional<ExecutorConfig>& executor)
   : RawSubscriber(
         {
             .name = topic_name,
         },
-        qos, std::move(data_cb), std::move(match_cb)) {
+        qos, std::move(data_cb), std::move(match_cb), executor) {
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -133,4 +322,29 @@ auto RawSubscriber::id() const -> std::uint64_t {
   return impl_->GetTopicId().topic_id.entity_id;
 }
 
+//-------------------------------------------------------------------------------------------------
+auto RawSubscriber::queueDepth() const -> std::size_t {
+  return (impl_->executor != nullptr) ? impl_->executor->queueDepth() : 0U;
+}
+
+//-------------------------------------------------------------------------------------------------
+auto RawSubscriber::dropCount() const -> std::uint64_t {
+  return (impl_->executor != nullptr) ? impl_->executor->dropCount() : 0U;
+}
+
+//-------------------------------------------------------------------------------------------------
+auto RawSubscriber::gapCount() const -> std::uint64_t {
+  return impl_->sequence_tracker->gapCount();
+}
+
+//-------------------------------------------------------------------------------------------------
+auto RawSubscriber::duplicateCount() const -> std::uint64_t {
+  return impl_->sequence_tracker->duplicateCount();
+}
+
+//-------------------------------------------------------------------------------------------------
+auto RawSubscriber::stats() const -> EndpointStats {
+  return impl_->stats->snapshot();
+}
+
 }  // namespace grape::ipc
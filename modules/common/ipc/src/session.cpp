@@ -14,6 +14,7 @@
 #include "default_config.h"
 #include "grape/exception.h"
 #include "grape/ipc/config.h"
+#include "intra_process.h"
 
 namespace grape::ipc {
 
@@ -32,6 +33,7 @@ void init(const Config& config) {
       ecal_config.communication_mode = eCAL::eCommunicationMode::network;
       break;
   }
+  setIntraProcessDelivery(config.intra_process);
   eCAL::Initialize(ecal_config, config.name);
   std::ignore = std::atexit([]() { eCAL::Finalize(); });
 }
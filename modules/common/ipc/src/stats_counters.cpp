@@ -0,0 +1,70 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#include "stats_counters.h"
+
+#include <algorithm>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace {
+
+//-------------------------------------------------------------------------------------------------
+// Endpoints of this process with counters, and the lock guarding them
+struct StatsRegistry {
+  std::mutex mutex;
+  std::vector<grape::ipc::StatsEntry> entries;
+};
+
+//-------------------------------------------------------------------------------------------------
+auto statsRegistry() -> StatsRegistry& {
+  static auto registry = StatsRegistry{};
+  return registry;
+}
+
+}  // namespace
+
+namespace grape::ipc {
+
+//-------------------------------------------------------------------------------------------------
+auto StatsCounters::snapshot() const -> EndpointStats {
+  auto stats = EndpointStats{
+    .messages = messages_.load(std::memory_order_relaxed),
+    .bytes = bytes_.load(std::memory_order_relaxed),
+    .dropped = dropped_.load(std::memory_order_relaxed),
+    .send_failures = send_failures_.load(std::memory_order_relaxed),
+    .callback_time = std::chrono::nanoseconds(callback_ns_.load(std::memory_order_relaxed)),
+    .latency = {},
+  };
+  for (auto i = 0UZ; i < latency_buckets_.size(); ++i) {
+    const auto count = latency_buckets_.at(i).load(std::memory_order_relaxed);
+    if (count > 0U) {
+      stats.latency.record(LatencyHistogram::bucketUpperBound(i), count);
+    }
+  }
+  return stats;
+}
+
+//-------------------------------------------------------------------------------------------------
+void registerStats(StatsEntry&& entry) {
+  auto& registry = statsRegistry();
+  const auto lock = std::lock_guard(registry.mutex);
+  std::erase_if(registry.entries, [](const StatsEntry& e) { return e.counters.expired(); });
+  registry.entries.push_back(std::move(entry));
+}
+
+//-------------------------------------------------------------------------------------------------
+void forEachStats(const std::function<void(const StatsEntry&, const StatsCounters&)>& fn) {
+  auto& registry = statsRegistry();
+  const auto lock = std::lock_guard(registry.mutex);
+  std::erase_if(registry.entries, [](const StatsEntry& e) { return e.counters.expired(); });
+  for (const auto& entry : registry.entries) {
+    if (const auto counters = entry.counters.lock(); counters != nullptr) {
+      fn(entry, *counters);
+    }
+  }
+}
+
+}  // namespace grape::ipc
@@ -0,0 +1,80 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+
+#include "grape/ipc/entity_id.h"
+#include "grape/ipc/stats.h"
+
+namespace grape::ipc {
+
+//=================================================================================================
+/// Counters behind EndpointStats. Updated lock-free; safe to update and read concurrently.
+class StatsCounters {
+public:
+  /// Count a message published or delivered
+  void countMessage(std::size_t bytes) {
+    messages_.fetch_add(1U, std::memory_order_relaxed);
+    bytes_.fetch_add(bytes, std::memory_order_relaxed);
+  }
+
+  /// Count a drop event reported by the transport
+  void countDrop() {
+    dropped_.fetch_add(1U, std::memory_order_relaxed);
+  }
+
+  /// Count a message or batch that the transport failed to send
+  void countSendFailure() {
+    send_failures_.fetch_add(1U, std::memory_order_relaxed);
+  }
+
+  /// Record time taken by an invocation of the data callback
+  void countCallbackTime(std::chrono::nanoseconds duration) {
+    callback_ns_.fetch_add(static_cast<std::uint64_t>(duration.count()), std::memory_order_relaxed);
+  }
+
+  /// Record latency of a delivered message. Negative latencies (clocks out of sync) count as 0
+  void countLatency(std::chrono::nanoseconds latency) {
+    const auto ns = static_cast<std::uint64_t>(std::max<std::int64_t>(latency.count(), 0));
+    latency_buckets_.at(LatencyHistogram::bucketIndex(ns)).fetch_add(1U, std::memory_order_relaxed);
+  }
+
+  /// @return Current values of counters. Latencies are reported to within histogram precision
+  [[nodiscard]] auto snapshot() const -> EndpointStats;
+
+private:
+  std::atomic_uint64_t messages_{ 0 };
+  std::atomic_uint64_t bytes_{ 0 };
+  std::atomic_uint64_t dropped_{ 0 };
+  std::atomic_uint64_t send_failures_{ 0 };
+  std::atomic_uint64_t callback_ns_{ 0 };
+  std::array<std::atomic_uint64_t, LatencyHistogram::BUCKET_COUNT> latency_buckets_{};
+};
+
+//=================================================================================================
+/// Identifies the endpoint that owns a set of counters. See registerStats
+struct StatsEntry {
+  EndpointStatsReport::Role role{ EndpointStatsReport::Role::Publisher };
+  std::string topic;
+  EntityId endpoint;
+  std::weak_ptr<const StatsCounters> counters;
+};
+
+/// Make counters of an endpoint visible to forEachStats, for as long as the counters exist
+void registerStats(StatsEntry&& entry);
+
+/// Invoke function on counters of every endpoint in this process that still exists. Holds the
+/// registry lock throughout, so the function must not create or destroy endpoints
+void forEachStats(const std::function<void(const StatsEntry&, const StatsCounters&)>& fn);
+
+}  // namespace grape::ipc
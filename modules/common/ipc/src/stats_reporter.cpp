@@ -0,0 +1,100 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "grape/ipc/publisher.h"
+#include "grape/ipc/stats.h"
+#include "stats_counters.h"
+
+namespace grape::ipc {
+
+//=================================================================================================
+struct StatsReporter::Impl {
+  /// Counts at the previous report, from which rates are computed
+  struct Previous {
+    std::uint64_t messages{ 0 };
+    std::uint64_t bytes{ 0 };
+  };
+
+  void run() {
+    auto lock = std::unique_lock(mutex);
+    while (not cv.wait_for(lock, period, [this] { return stop; })) {
+      report();
+    }
+  }
+
+  void report() {
+    // Build reports under the registry lock, but publish them only after it is released, since
+    // subscribers to the reports in this process are invoked on this thread and may create or
+    // destroy endpoints
+    const auto period_sec = std::chrono::duration<double>(period).count();
+    auto reports = std::vector<EndpointStatsReport>{};
+    auto seen = std::unordered_map<std::uint64_t, Previous>{};
+    forEachStats([&](const StatsEntry& entry, const StatsCounters& counters) {
+      const auto stats = counters.snapshot();
+      const auto prev = previous.contains(entry.endpoint.id) ? previous.at(entry.endpoint.id)
+                                                               : Previous{};
+      const auto to_nanos = [](std::uint64_t ns) {
+        return std::chrono::nanoseconds(static_cast<std::int64_t>(ns));
+      };
+      static constexpr auto MEDIAN = 50.;
+      static constexpr auto TAIL = 99.;
+      reports.push_back({
+          .role = entry.role,
+          .topic = entry.topic,
+          .endpoint = entry.endpoint,
+          .messages = stats.messages,
+          .bytes = stats.bytes,
+          .dropped = stats.dropped,
+          .send_failures = stats.send_failures,
+          .message_rate = static_cast<double>(stats.messages - prev.messages) / period_sec,
+          .byte_rate = static_cast<double>(stats.bytes - prev.bytes) / period_sec,
+          .callback_time = stats.callback_time,
+          .latency_p50 = to_nanos(stats.latency.percentile(MEDIAN)),
+          .latency_p99 = to_nanos(stats.latency.percentile(TAIL)),
+          .latency_max = to_nanos(stats.latency.max()),
+      });
+      seen.emplace(entry.endpoint.id, Previous{ .messages = stats.messages, .bytes = stats.bytes });
+    });
+    previous = std::move(seen);  // forget endpoints that no longer exist
+    for (const auto& report : reports) {
+      std::ignore = publisher.publish(report);
+    }
+  }
+
+  std::chrono::milliseconds period;
+  Publisher<StatsTopic> publisher{ StatsTopic{} };
+  std::unordered_map<std::uint64_t, Previous> previous;
+  bool stop{ false };
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::thread thread;
+};
+
+//-------------------------------------------------------------------------------------------------
+StatsReporter::StatsReporter(std::chrono::milliseconds period)
+  : impl_(std::make_unique<Impl>(period)) {
+  impl_->thread = std::thread([impl = impl_.get()] { impl->run(); });
+}
+
+//-------------------------------------------------------------------------------------------------
+StatsReporter::~StatsReporter() {
+  {
+    const auto lock = std::lock_guard(impl_->mutex);
+    impl_->stop = true;
+  }
+  impl_->cv.notify_all();
+  impl_->thread.join();
+}
+
+}  // namespace grape::ipc
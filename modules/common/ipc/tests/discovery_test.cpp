@@ -0,0 +1,117 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#include "grape/ipc/discovery.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <format>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+#include "grape/ipc/config.h"
+#include "grape/ipc/raw_publisher.h"
+#include "grape/ipc/raw_subscriber.h"
+#include "grape/ipc/session.h"
+#include "grape/wall_clock.h"
+
+namespace {
+
+// NOLINTBEGIN(cert-err58-cpp)
+
+//=================================================================================================
+// Collects discovery events on a topic of interest
+class EventLog {
+public:
+  explicit EventLog(std::string topic) : topic_(std::move(topic)) {
+  }
+
+  void record(const grape::ipc::DiscoveryEvent& event) {
+    if (event.topic != topic_) {
+      return;
+    }
+    {
+      const auto lock = std::lock_guard(mutex_);
+      events_.push_back(event);
+    }
+    cv_.notify_all();
+  }
+
+  /// @return The first event of given kind and role, if logged within the timeout
+  auto waitFor(grape::ipc::DiscoveryEvent::Kind kind, grape::ipc::DiscoveryEvent::Role role)
+      -> std::optional<grape::ipc::DiscoveryEvent> {
+    static constexpr auto TIMEOUT = std::chrono::seconds(5);
+    auto lock = std::unique_lock(mutex_);
+    auto found = std::optional<grape::ipc::DiscoveryEvent>{};
+    cv_.wait_for(lock, TIMEOUT, [&] {
+      for (const auto& event : events_) {
+        if ((event.kind == kind) && (event.role == role)) {
+          found = event;
+          return true;
+        }
+      }
+      return false;
+    });
+    return found;
+  }
+
+private:
+  std::string topic_;
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::vector<grape::ipc::DiscoveryEvent> events_;
+};
+
+//=================================================================================================
+TEST_CASE("Discovery cache reports endpoints as they come and go", "[ipc]") {
+  using Kind = grape::ipc::DiscoveryEvent::Kind;
+  using Role = grape::ipc::DiscoveryEvent::Role;
+
+  grape::ipc::init(grape::ipc::Config{});
+  const auto topic = grape::ipc::Topic{
+    .name = std::format("discovery_cache_test_{}",
+                        grape::WallClock::now().time_since_epoch().count()),
+    .type_name = "byte",
+  };
+
+  auto log = EventLog(topic.name);
+  const auto cache =
+      grape::ipc::DiscoveryCache([&log](const grape::ipc::DiscoveryEvent& e) { log.record(e); });
+  REQUIRE_FALSE(cache.snapshot()->contains(topic.name));
+
+  auto publisher = std::make_optional<grape::ipc::RawPublisher>(topic);
+  const auto subscriber =
+      grape::ipc::RawSubscriber(topic, grape::ipc::QoS::BestEffort, [](const auto&) {});
+
+  const auto pub_added = log.waitFor(Kind::Added, Role::Publisher);
+  REQUIRE(pub_added.has_value());
+  REQUIRE(pub_added->endpoint.entity_id.id == publisher->id());
+  REQUIRE(pub_added->endpoint.type_name == topic.type_name);
+  REQUIRE(log.waitFor(Kind::Added, Role::Subscriber).has_value());
+
+  // snapshots are served from the cache and shared until the graph changes
+  const auto version = cache.version();
+  const auto snapshot = cache.snapshot();
+  REQUIRE(snapshot->at(topic.name).publishers.size() == 1);
+  REQUIRE(snapshot->at(topic.name).subscribers.size() == 1);
+  if (cache.version() == version) {
+    REQUIRE(cache.snapshot() == snapshot);
+  }
+
+  publisher.reset();
+  const auto pub_removed = log.waitFor(Kind::Removed, Role::Publisher);
+  REQUIRE(pub_removed.has_value());
+  REQUIRE(pub_removed->endpoint.type_name == topic.type_name);
+  REQUIRE(cache.version() > version);
+  REQUIRE(cache.snapshot()->at(topic.name).publishers.empty());
+  REQUIRE(snapshot->at(topic.name).publishers.size() == 1);  // earlier snapshot is unaffected
+}
+
+// NOLINTEND(cert-err58-cpp)
+
+}  // namespace
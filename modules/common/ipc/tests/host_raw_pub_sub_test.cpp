@@ -3,10 +3,15 @@
 //=================================================================================================
 
 #include <algorithm>
+#include <array>
 #include <climits>
+#include <mutex>
+#include <optional>
 #include <random>
 #include <semaphore>
 #include <thread>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 #include "catch2/catch_test_macros.hpp"
@@ -21,7 +26,8 @@ namespace {
 
 //=================================================================================================
 TEST_CASE("Basic pub-sub on large message works in host-only scope", "[ipc]") {
-  grape::ipc::init(grape::ipc::Config{});
+  // route samples through the transport rather than deliver them directly within the process
+  grape::ipc::init(grape::ipc::Config{ .intra_process = false });
   const auto topic = grape::ipc::Topic{
     .name = std::format("pub_sub_test_{}", grape::WallClock::now().time_since_epoch().count()),
     .type_name = "byte",
@@ -93,6 +99,333 @@ TEST_CASE("Basic pub-sub on large message works in host-only scope", "[ipc]") {
   REQUIRE(pub_id == publisher.id());
 }
 
+//=================================================================================================
+TEST_CASE("Large message written in-place into transport memory is received", "[ipc]") {
+  // route samples through the transport rather than deliver them directly within the process
+  grape::ipc::init(grape::ipc::Config{ .intra_process = false });
+  const auto topic = grape::ipc::Topic{
+    .name = std::format("pub_sub_inplace_test_{}",
+                        grape::WallClock::now().time_since_epoch().count()),
+    .type_name = "byte",
+  };
+
+  constexpr auto PAYLOAD_SIZE = 1920U * 1080U * 3;
+  constexpr auto PATTERN_PERIOD = 251U;  // prime, so the pattern does not align with page sizes
+  const auto pattern = [](std::size_t i) { return static_cast<std::byte>(i % PATTERN_PERIOD); };
+
+  std::binary_semaphore is_data_received{ 0 };
+  auto received_msg = std::vector<std::byte>{};
+  const auto recv_callback = [&is_data_received,
+                              &received_msg](const grape::ipc::Sample& sample) -> void {
+    received_msg = std::vector<std::byte>(sample.data.begin(), sample.data.end());
+    is_data_received.release();
+  };
+
+  auto publisher = grape::ipc::RawPublisher(topic);
+  auto subscriber = grape::ipc::RawSubscriber(topic, grape::ipc::QoS::BestEffort, recv_callback);
+
+  constexpr auto RETRY_COUNT = 10U;
+  auto count_down = RETRY_COUNT;
+  while ((subscriber.publisherCount() == 0) && (count_down > 0)) {
+    constexpr auto REG_WAIT_TIME = std::chrono::milliseconds(200);
+    std::this_thread::sleep_for(REG_WAIT_TIME);
+    count_down--;
+  }
+  REQUIRE(subscriber.publisherCount() == 1);
+
+  // a writer that fails is reported as such
+  const auto failing_writer = [](std::span<std::byte>) -> bool { return false; };
+  const auto fail_result = publisher.publish(PAYLOAD_SIZE, failing_writer);
+  REQUIRE_FALSE(fail_result.has_value());
+  REQUIRE(fail_result.error() == grape::ipc::Error::SerialisationFailed);
+
+  auto written_size = 0UZ;
+  const auto writer = [&pattern, &written_size](std::span<std::byte> buffer) -> bool {
+    written_size = buffer.size_bytes();
+    for (auto i = 0UZ; i < buffer.size_bytes(); ++i) {
+      buffer[i] = pattern(i);
+    }
+    return true;
+  };
+  REQUIRE(publisher.publish(PAYLOAD_SIZE, writer).has_value());
+  REQUIRE(written_size == PAYLOAD_SIZE);
+
+  constexpr auto RECV_WAIT_TIME = std::chrono::milliseconds(1000);
+  REQUIRE(is_data_received.try_acquire_for(RECV_WAIT_TIME));
+  REQUIRE(received_msg.size() == PAYLOAD_SIZE);
+  for (auto i = 0UZ; i < received_msg.size(); ++i) {
+    REQUIRE(received_msg[i] == pattern(i));
+  }
+}
+
+//=================================================================================================
+TEST_CASE("Executor queues samples behind a slow callback and drops the oldest", "[ipc]") {
+  grape::ipc::init(grape::ipc::Config{});
+  const auto topic = grape::ipc::Topic{
+    .name = std::format("pub_sub_executor_test_{}",
+                        grape::WallClock::now().time_since_epoch().count()),
+    .type_name = "byte",
+  };
+
+  // callback blocks on the first sample until released, holding up the only worker
+  constexpr auto NUM_SAMPLES = 10U;
+  std::counting_semaphore<NUM_SAMPLES> gate{ 0 };
+  std::counting_semaphore<NUM_SAMPLES> samples_received{ 0 };
+  auto mutex = std::mutex{};
+  auto received = std::vector<std::byte>{};
+  const auto recv_callback = [&gate, &samples_received, &mutex,
+                              &received](const grape::ipc::Sample& sample) -> void {
+    gate.acquire();
+    {
+      const auto lock = std::lock_guard(mutex);
+      received.push_back(sample.data.front());
+    }
+    samples_received.release();
+  };
+
+  constexpr auto QUEUE_DEPTH = 2U;
+  const auto executor = grape::ipc::ExecutorConfig{
+    .queue_depth = QUEUE_DEPTH,
+    .num_workers = 1,
+    .policy = grape::ipc::ExecutorConfig::Policy::DropOldest,
+  };
+  auto publisher = grape::ipc::RawPublisher(topic);
+  auto subscriber = grape::ipc::RawSubscriber(topic, grape::ipc::QoS::BestEffort, recv_callback,
+                                              nullptr, executor);
+
+  constexpr auto RETRY_COUNT = 10U;
+  auto count_down = RETRY_COUNT;
+  while ((subscriber.publisherCount() == 0) && (count_down > 0)) {
+    constexpr auto REG_WAIT_TIME = std::chrono::milliseconds(200);
+    std::this_thread::sleep_for(REG_WAIT_TIME);
+    count_down--;
+  }
+  REQUIRE(subscriber.publisherCount() == 1);
+
+  // publishing continues unhindered by the blocked callback
+  for (auto i = 0U; i < NUM_SAMPLES; ++i) {
+    const auto payload = std::array{ static_cast<std::byte>(i) };
+    REQUIRE(publisher.publish(payload).has_value());
+    constexpr auto PUB_INTERVAL = std::chrono::milliseconds(20);
+    std::this_thread::sleep_for(PUB_INTERVAL);
+  }
+
+  // first sample is with the worker, the queue holds the last two, and the rest are dropped
+  REQUIRE(subscriber.queueDepth() == QUEUE_DEPTH);
+  REQUIRE(subscriber.dropCount() == NUM_SAMPLES - 1 - QUEUE_DEPTH);
+
+  gate.release(NUM_SAMPLES);
+  constexpr auto RECV_WAIT_TIME = std::chrono::milliseconds(1000);
+  for (auto i = 0U; i < 1 + QUEUE_DEPTH; ++i) {
+    REQUIRE(samples_received.try_acquire_for(RECV_WAIT_TIME));
+  }
+  REQUIRE(subscriber.queueDepth() == 0);
+  const auto lock = std::lock_guard(mutex);
+  REQUIRE(received == std::vector{ std::byte{ 0 }, std::byte{ 8 }, std::byte{ 9 } });
+}
+
+//=================================================================================================
+TEST_CASE("Samples carry nanosecond publish time and consecutive sequence numbers", "[ipc]") {
+  // route samples through the transport rather than deliver them directly within the process
+  grape::ipc::init(grape::ipc::Config{ .intra_process = false });
+  const auto topic = grape::ipc::Topic{
+    .name = std::format("pub_sub_sequence_test_{}",
+                        grape::WallClock::now().time_since_epoch().count()),
+    .type_name = "byte",
+  };
+
+  constexpr auto NUM_SAMPLES = 5U;
+  std::counting_semaphore<NUM_SAMPLES> samples_received{ 0 };
+  auto mutex = std::mutex{};
+  auto infos = std::vector<grape::ipc::SampleInfo>{};
+  const auto recv_callback = [&samples_received, &mutex,
+                              &infos](const grape::ipc::Sample& sample) -> void {
+    {
+      const auto lock = std::lock_guard(mutex);
+      infos.push_back(sample.info);
+    }
+    samples_received.release();
+  };
+
+  auto publisher = grape::ipc::RawPublisher(topic);
+  auto subscriber = grape::ipc::RawSubscriber(topic, grape::ipc::QoS::BestEffort, recv_callback);
+
+  constexpr auto RETRY_COUNT = 10U;
+  auto count_down = RETRY_COUNT;
+  while ((subscriber.publisherCount() == 0) && (count_down > 0)) {
+    constexpr auto REG_WAIT_TIME = std::chrono::milliseconds(200);
+    std::this_thread::sleep_for(REG_WAIT_TIME);
+    count_down--;
+  }
+  REQUIRE(subscriber.publisherCount() == 1);
+
+  using TimeWindow = std::pair<grape::WallClock::TimePoint, grape::WallClock::TimePoint>;
+  auto publish_windows = std::vector<TimeWindow>{};
+  for (auto i = 0U; i < NUM_SAMPLES; ++i) {
+    const auto payload = std::array{ static_cast<std::byte>(i) };
+    const auto before = grape::WallClock::now();
+    REQUIRE(publisher.publish(payload).has_value());
+    publish_windows.emplace_back(before, grape::WallClock::now());
+    constexpr auto RECV_WAIT_TIME = std::chrono::milliseconds(1000);
+    REQUIRE(samples_received.try_acquire_for(RECV_WAIT_TIME));
+  }
+
+  const auto lock = std::lock_guard(mutex);
+  REQUIRE(infos.size() == NUM_SAMPLES);
+  for (auto i = 0U; i < NUM_SAMPLES; ++i) {
+    // timestamp is not truncated to a coarser resolution than the clock's
+    REQUIRE(infos.at(i).publish_time >= publish_windows.at(i).first);
+    REQUIRE(infos.at(i).publish_time <= publish_windows.at(i).second);
+    if (i > 0) {
+      REQUIRE(infos.at(i).sequence == infos.at(i - 1).sequence + 1);
+    }
+  }
+  REQUIRE(subscriber.gapCount() == 0);
+  REQUIRE(subscriber.duplicateCount() == 0);
+}
+
+//=================================================================================================
+TEST_CASE("Batching publisher delivers each message individually and in order", "[ipc]") {
+  // route samples through the transport rather than deliver them directly within the process
+  grape::ipc::init(grape::ipc::Config{ .intra_process = false });
+  const auto topic = grape::ipc::Topic{
+    .name = std::format("pub_sub_batching_test_{}",
+                        grape::WallClock::now().time_since_epoch().count()),
+    .type_name = "byte",
+  };
+
+  constexpr auto NUM_SAMPLES = 10U;
+  std::counting_semaphore<NUM_SAMPLES> samples_received{ 0 };
+  auto mutex = std::mutex{};
+  auto samples = std::vector<std::pair<std::vector<std::byte>, grape::ipc::SampleInfo>>{};
+  const auto recv_callback = [&samples_received, &mutex,
+                              &samples](const grape::ipc::Sample& sample) -> void {
+    {
+      const auto lock = std::lock_guard(mutex);
+      samples.emplace_back(std::vector(sample.data.begin(), sample.data.end()), sample.info);
+    }
+    samples_received.release();
+  };
+
+  constexpr auto BATCH_CONFIG = grape::ipc::BatchConfig{ .max_messages = 4U,
+                                                         .max_bytes = 1024U,
+                                                         .max_delay = std::chrono::seconds(1) };
+  auto publisher = grape::ipc::RawPublisher(topic, nullptr, BATCH_CONFIG);
+  auto subscriber = grape::ipc::RawSubscriber(topic, grape::ipc::QoS::BestEffort, recv_callback);
+
+  constexpr auto RETRY_COUNT = 10U;
+  auto count_down = RETRY_COUNT;
+  while ((subscriber.publisherCount() == 0) && (count_down > 0)) {
+    constexpr auto REG_WAIT_TIME = std::chrono::milliseconds(200);
+    std::this_thread::sleep_for(REG_WAIT_TIME);
+    count_down--;
+  }
+  REQUIRE(subscriber.publisherCount() == 1);
+
+  for (auto i = 0U; i < NUM_SAMPLES; ++i) {
+    const auto payload = std::array{ static_cast<std::byte>(i) };
+    REQUIRE(publisher.publish(payload).has_value());
+  }
+  REQUIRE(publisher.flush().has_value());
+  for (auto i = 0U; i < NUM_SAMPLES; ++i) {
+    constexpr auto RECV_WAIT_TIME = std::chrono::milliseconds(1000);
+    REQUIRE(samples_received.try_acquire_for(RECV_WAIT_TIME));
+  }
+
+  const auto lock = std::lock_guard(mutex);
+  REQUIRE(samples.size() == NUM_SAMPLES);
+  for (auto i = 0U; i < NUM_SAMPLES; ++i) {
+    REQUIRE(samples.at(i).first == std::vector{ static_cast<std::byte>(i) });
+    if (i > 0) {
+      REQUIRE(samples.at(i).second.sequence == samples.at(i - 1).second.sequence + 1);
+      REQUIRE(samples.at(i).second.publish_time >= samples.at(i - 1).second.publish_time);
+    }
+  }
+  REQUIRE(subscriber.gapCount() == 0);
+}
+
+//=================================================================================================
+TEST_CASE("Endpoints keep statistics of messages delivered and their latency", "[ipc]") {
+  grape::ipc::init(grape::ipc::Config{});
+  const auto topic = grape::ipc::Topic{
+    .name = std::format("pub_sub_stats_test_{}",
+                        grape::WallClock::now().time_since_epoch().count()),
+    .type_name = "byte",
+  };
+
+  constexpr auto NUM_SAMPLES = 5U;
+  constexpr auto PAYLOAD_SIZE = 64U;
+  std::counting_semaphore<NUM_SAMPLES> samples_received{ 0 };
+  const auto recv_callback = [&samples_received](const grape::ipc::Sample&) -> void {
+    samples_received.release();
+  };
+
+  auto publisher = grape::ipc::RawPublisher(topic);
+  auto subscriber = grape::ipc::RawSubscriber(topic, grape::ipc::QoS::BestEffort, recv_callback);
+
+  constexpr auto RETRY_COUNT = 10U;
+  auto count_down = RETRY_COUNT;
+  while ((subscriber.publisherCount() == 0) && (count_down > 0)) {
+    constexpr auto REG_WAIT_TIME = std::chrono::milliseconds(200);
+    std::this_thread::sleep_for(REG_WAIT_TIME);
+    count_down--;
+  }
+  REQUIRE(subscriber.publisherCount() == 1);
+
+  const auto payload = std::vector<std::byte>(PAYLOAD_SIZE);
+  for (auto i = 0U; i < NUM_SAMPLES; ++i) {
+    REQUIRE(publisher.publish(payload).has_value());
+    constexpr auto RECV_WAIT_TIME = std::chrono::milliseconds(1000);
+    REQUIRE(samples_received.try_acquire_for(RECV_WAIT_TIME));
+  }
+
+  const auto pub_stats = publisher.stats();
+  REQUIRE(pub_stats.messages == NUM_SAMPLES);
+  REQUIRE(pub_stats.bytes == NUM_SAMPLES * PAYLOAD_SIZE);
+  REQUIRE(pub_stats.send_failures == 0);
+  REQUIRE(pub_stats.latency.count() == 0);
+
+  const auto sub_stats = subscriber.stats();
+  REQUIRE(sub_stats.messages == NUM_SAMPLES);
+  REQUIRE(sub_stats.bytes == NUM_SAMPLES * PAYLOAD_SIZE);
+  REQUIRE(sub_stats.dropped == 0);
+  REQUIRE(sub_stats.latency.count() == NUM_SAMPLES);
+  REQUIRE(sub_stats.callback_time >= std::chrono::nanoseconds::zero());
+}
+
+//=================================================================================================
+TEST_CASE("Callbacks may publish and create or destroy subscribers on their own topic", "[ipc]") {
+  grape::ipc::init(grape::ipc::Config{});
+  const auto topic = grape::ipc::Topic{
+    .name = std::format("pub_sub_reentrant_test_{}",
+                        grape::WallClock::now().time_since_epoch().count()),
+    .type_name = "byte",
+  };
+
+  // Samples from publishers in this process are delivered on the publishing thread, so all of
+  // the following happens within the first publish() call
+  auto publisher = grape::ipc::RawPublisher(topic);
+  auto other = std::optional<grape::ipc::RawSubscriber>{};
+  auto received = std::vector<std::byte>{};
+  const auto recv_callback = [&publisher, &other, &received,
+                              &topic](const grape::ipc::Sample& sample) -> void {
+    received.push_back(sample.data.front());
+    if (sample.data.front() == std::byte{ 1 }) {
+      other.emplace(topic, grape::ipc::QoS::BestEffort, [](const grape::ipc::Sample&) {});
+      const auto payload = std::array{ std::byte{ 2 } };
+      std::ignore = publisher.publish(payload);
+    } else {
+      other.reset();
+    }
+  };
+  auto subscriber = grape::ipc::RawSubscriber(topic, grape::ipc::QoS::BestEffort, recv_callback);
+
+  const auto payload = std::array{ std::byte{ 1 } };
+  REQUIRE(publisher.publish(payload).has_value());
+  REQUIRE(received == std::vector{ std::byte{ 1 }, std::byte{ 2 } });
+  REQUIRE_FALSE(other.has_value());
+}
+
 // NOLINTEND(cert-err58-cpp)
 
 }  // namespace
@@ -22,7 +22,9 @@ namespace {
 
 //=================================================================================================
 TEST_CASE("Basic pub-sub in network scope works", "[ipc]") {
-  const auto config = grape::ipc::Config{ .scope = grape::ipc::Config::Scope::Network };
+  // route samples through the transport rather than deliver them directly within the process
+  const auto config =
+      grape::ipc::Config{ .scope = grape::ipc::Config::Scope::Network, .intra_process = false };
   grape::ipc::init(config);
 
   const auto topic_name =
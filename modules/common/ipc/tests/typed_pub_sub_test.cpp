@@ -3,6 +3,8 @@
 //=================================================================================================
 
 #include <algorithm>
+#include <mutex>
+#include <optional>
 #include <random>
 #include <semaphore>
 #include <thread>
@@ -12,7 +14,10 @@
 #include "grape/ipc/config.h"
 #include "grape/ipc/publisher.h"
 #include "grape/ipc/session.h"
+#include "grape/ipc/stats.h"
 #include "grape/ipc/subscriber.h"
+#include "grape/ipc/view_subscriber.h"
+#include "grape/serdes/size.h"
 
 namespace {
 struct TestDataType {
@@ -30,11 +35,33 @@ struct TestTopicAttributes {
   }
 };
 
+// Too small a serialisation buffer for any useful message, to detect attempts to serialise
+struct UnserialisableTopicAttributes {
+  using DataType = TestDataType;
+  static constexpr auto QOS = grape::ipc::QoS::BestEffort;
+  static constexpr auto SERDES_BUFFER_SIZE = 1U;
+  static auto topicName() -> std::string {
+    static auto now = grape::WallClock::now().time_since_epoch().count();
+    return { std::format("typed_pub_sub_intra_process_test_{}", now) };
+  }
+};
+
+// Does not bound the size of serialised data
+struct UnboundedTopicAttributes {
+  using DataType = TestDataType;
+  static constexpr auto QOS = grape::ipc::QoS::BestEffort;
+  static auto topicName() -> std::string {
+    static auto now = grape::WallClock::now().time_since_epoch().count();
+    return { std::format("typed_pub_sub_unbounded_test_{}", now) };
+  }
+};
+
 }  // namespace
 
 //=================================================================================================
 TEST_CASE("Basic functionality of pub-sub templated on topic attributes", "[ipc]") {
-  grape::ipc::init(grape::ipc::Config{});
+  // route samples through the transport rather than deliver them directly within the process
+  grape::ipc::init(grape::ipc::Config{ .intra_process = false });
 
   std::binary_semaphore is_data_received{ 0 };
   auto received_data = TestDataType{};
@@ -80,3 +107,326 @@ TEST_CASE("Basic functionality of pub-sub templated on topic attributes", "[ipc]
   REQUIRE(received_data.id == test_data.id);
   REQUIRE(received_data.message == test_data.message);
 }
+
+//=================================================================================================
+TEST_CASE("View subscriber reads members in place", "[ipc]") {
+  grape::ipc::init(grape::ipc::Config{});
+
+  std::binary_semaphore is_data_received{ 0 };
+  auto received_id = std::uint64_t{};
+  auto received_message = std::string{};
+
+  using DataView = grape::ipc::ViewSubscriber<TestTopicAttributes>::DataView;
+  const auto data_cb = [&is_data_received, &received_id, &received_message](
+                           const std::expected<DataView, grape::ipc::Error>& data,
+                           const grape::ipc::SampleInfo& /*info*/) {
+    if (not data) {
+      return;
+    }
+    received_id = data->get<0>();
+    received_message = data->get<1>();
+    is_data_received.release();
+  };
+
+  // create pub/sub
+  auto publisher = grape::ipc::Publisher(TestTopicAttributes{});
+  auto subscriber = grape::ipc::ViewSubscriber(TestTopicAttributes{}, data_cb);
+
+  // wait for match
+  constexpr auto RETRY_COUNT = 10U;
+  auto count_down = RETRY_COUNT;
+  while ((subscriber.publisherCount() == 0U) && (count_down > 0)) {
+    constexpr auto REG_WAIT_TIME = std::chrono::milliseconds(200);
+    std::this_thread::sleep_for(REG_WAIT_TIME);
+    count_down--;
+  }
+  REQUIRE(subscriber.publisherCount() == 1U);
+
+  const auto test_data = TestDataType{ .id = 24, .message = "Viewed in place" };
+  REQUIRE(publisher.publish(test_data).has_value());
+
+  constexpr auto RECV_WAIT_TIME = std::chrono::milliseconds(1000);
+  REQUIRE(is_data_received.try_acquire_for(RECV_WAIT_TIME));
+  REQUIRE(received_id == test_data.id);
+  REQUIRE(received_message == test_data.message);
+}
+
+//=================================================================================================
+TEST_CASE("Subscriber reuses decoded data storage across samples", "[ipc]") {
+  // route samples through the transport rather than deliver them directly within the process
+  grape::ipc::init(grape::ipc::Config{ .intra_process = false });
+
+  std::counting_semaphore<2> samples_received{ 0 };
+  auto message_buffers = std::vector<const char*>{};
+
+  const auto data_cb = [&samples_received, &message_buffers](
+                           const std::expected<TestDataType, grape::ipc::Error>& data,
+                           const grape::ipc::SampleInfo& /*info*/) {
+    if (not data) {
+      return;
+    }
+    message_buffers.push_back(data->message.data());
+    samples_received.release();
+  };
+
+  auto publisher = grape::ipc::Publisher(TestTopicAttributes{});
+  auto subscriber = grape::ipc::Subscriber(TestTopicAttributes{}, data_cb);
+
+  // wait for match
+  constexpr auto RETRY_COUNT = 10U;
+  auto count_down = RETRY_COUNT;
+  while ((subscriber.publisherCount() == 0U) && (count_down > 0)) {
+    constexpr auto REG_WAIT_TIME = std::chrono::milliseconds(200);
+    std::this_thread::sleep_for(REG_WAIT_TIME);
+    count_down--;
+  }
+  REQUIRE(subscriber.publisherCount() == 1U);
+
+  // second message fits in storage grown for the first, so it must be decoded in place
+  constexpr auto RECV_WAIT_TIME = std::chrono::milliseconds(1000);
+  const auto long_message = std::string(64, 'a');
+  const auto short_message = std::string(48, 'b');
+  REQUIRE(publisher.publish(TestDataType{ .id = 1, .message = long_message }).has_value());
+  REQUIRE(samples_received.try_acquire_for(RECV_WAIT_TIME));
+  REQUIRE(publisher.publish(TestDataType{ .id = 2, .message = short_message }).has_value());
+  REQUIRE(samples_received.try_acquire_for(RECV_WAIT_TIME));
+
+  REQUIRE(message_buffers.size() == 2);
+  REQUIRE(message_buffers.at(0) == message_buffers.at(1));
+}
+
+//=================================================================================================
+TEST_CASE("Subscriber in the same process receives data without serialisation", "[ipc]") {
+  grape::ipc::init(grape::ipc::Config{});
+
+  auto received_data = std::optional<TestDataType>{};
+  auto callback_thread = std::thread::id{};
+  const auto data_cb = [&received_data, &callback_thread](
+                           const std::expected<TestDataType, grape::ipc::Error>& data,
+                           const grape::ipc::SampleInfo& /*info*/) {
+    if (data) {
+      received_data = data.value();
+    }
+    callback_thread = std::this_thread::get_id();
+  };
+
+  auto publisher = grape::ipc::Publisher(UnserialisableTopicAttributes{});
+  auto subscriber = grape::ipc::Subscriber(UnserialisableTopicAttributes{}, data_cb);
+
+  // data is delivered on the publishing thread before publish returns, and would have failed to
+  // publish had it been serialised
+  const auto test_data = TestDataType{ .id = 42, .message = "Too long to serialise" };
+  REQUIRE(publisher.publish(test_data).has_value());
+  REQUIRE(callback_thread == std::this_thread::get_id());
+  REQUIRE(received_data.has_value());
+  REQUIRE(received_data->id == test_data.id);
+  REQUIRE(received_data->message == test_data.message);
+}
+
+//=================================================================================================
+TEST_CASE("Reference callbacks receive objects in the same process without copying", "[ipc]") {
+  grape::ipc::init(grape::ipc::Config{});
+
+  const TestDataType* received = nullptr;
+  auto error_count = 0U;
+  using Subscriber = grape::ipc::Subscriber<TestTopicAttributes>;
+  auto publisher = grape::ipc::Publisher(TestTopicAttributes{});
+  auto subscriber = Subscriber(
+      TestTopicAttributes{},
+      Subscriber::ReferenceCallbacks{
+          .on_data = [&received](const TestDataType& data,
+                                 const grape::ipc::SampleInfo& /*info*/) { received = &data; },
+          .on_error = [&error_count](grape::ipc::Error /*error*/,
+                                     const grape::ipc::SampleInfo& /*info*/) { error_count++; } });
+
+  const auto test_data = TestDataType{ .id = 42, .message = "Handed over by reference" };
+  REQUIRE(publisher.publish(test_data).has_value());
+  REQUIRE(received == &test_data);
+  REQUIRE(error_count == 0U);
+}
+
+//=================================================================================================
+TEST_CASE("Objects handed over in the same process count their serialised size", "[ipc]") {
+  grape::ipc::init(grape::ipc::Config{});
+
+  auto received_count = 0U;
+  const auto data_cb = [&received_count](const std::expected<TestDataType, grape::ipc::Error>& data,
+                                         const grape::ipc::SampleInfo& /*info*/) {
+    if (data) {
+      received_count++;
+    }
+  };
+
+  auto publisher = grape::ipc::Publisher(TestTopicAttributes{});
+  auto subscriber = grape::ipc::Subscriber(TestTopicAttributes{}, data_cb);
+
+  constexpr auto NUM_SAMPLES = 3U;
+  const auto test_data = TestDataType{ .id = 42, .message = "Handed over as is" };
+  for (auto i = 0U; i < NUM_SAMPLES; ++i) {
+    REQUIRE(publisher.publish(test_data).has_value());
+  }
+  REQUIRE(received_count == NUM_SAMPLES);
+
+  const auto expected_bytes = NUM_SAMPLES * grape::serdes::serialisedSize(test_data);
+  REQUIRE(publisher.stats().bytes == expected_bytes);
+  REQUIRE(subscriber.stats().bytes == expected_bytes);
+}
+
+//=================================================================================================
+TEST_CASE("Topics without a serialisation buffer size publish data of any size", "[ipc]") {
+  grape::ipc::init(grape::ipc::Config{});
+
+  STATIC_REQUIRE(grape::ipc::BoundedTopicAttributes<TestTopicAttributes>);
+  STATIC_REQUIRE(not grape::ipc::BoundedTopicAttributes<UnboundedTopicAttributes>);
+
+  std::binary_semaphore is_data_received{ 0 };
+  auto received_size = 0UZ;
+  using DataView = grape::ipc::ViewSubscriber<UnboundedTopicAttributes>::DataView;
+  const auto data_cb = [&is_data_received, &received_size](
+                           const std::expected<DataView, grape::ipc::Error>& data,
+                           const grape::ipc::SampleInfo& /*info*/) {
+    if (data) {
+      received_size = data->get<1>().size();
+    }
+    is_data_received.release();
+  };
+
+  // a view subscriber requires the data to be serialised even within the process
+  auto publisher = grape::ipc::Publisher(UnboundedTopicAttributes{});
+  auto subscriber = grape::ipc::ViewSubscriber(UnboundedTopicAttributes{}, data_cb);
+
+  constexpr auto RETRY_COUNT = 10U;
+  auto count_down = RETRY_COUNT;
+  while ((subscriber.publisherCount() == 0U) && (count_down > 0)) {
+    constexpr auto REG_WAIT_TIME = std::chrono::milliseconds(200);
+    std::this_thread::sleep_for(REG_WAIT_TIME);
+    count_down--;
+  }
+  REQUIRE(subscriber.publisherCount() == 1U);
+
+  constexpr auto MESSAGE_SIZE = 4UZ * 1024UZ * 1024UZ;
+  const auto test_data = TestDataType{ .id = 1, .message = std::string(MESSAGE_SIZE, 'x') };
+  REQUIRE(publisher.publish(test_data).has_value());
+
+  constexpr auto RECV_WAIT_TIME = std::chrono::milliseconds(1000);
+  REQUIRE(is_data_received.try_acquire_for(RECV_WAIT_TIME));
+  REQUIRE(received_size == MESSAGE_SIZE);
+}
+
+//=================================================================================================
+TEST_CASE("Stats reporter publishes statistics of endpoints in this process", "[ipc]") {
+  grape::ipc::init(grape::ipc::Config{});
+
+  auto publisher = grape::ipc::Publisher(TestTopicAttributes{});
+  auto subscriber = grape::ipc::Subscriber(
+      TestTopicAttributes{},
+      [](const std::expected<TestDataType, grape::ipc::Error>&, const grape::ipc::SampleInfo&) {});
+  REQUIRE(publisher.publish(TestDataType{ .id = 1, .message = "hello" }).has_value());
+
+  using Report = grape::ipc::EndpointStatsReport;
+  auto mutex = std::mutex{};
+  auto report = std::optional<Report>{};
+  std::binary_semaphore report_received{ 0 };
+  const auto stats_cb = [&](const std::expected<Report, grape::ipc::Error>& data,
+                            const grape::ipc::SampleInfo& /*info*/) {
+    const auto lock = std::lock_guard(mutex);
+    if (data && (not report.has_value()) && (data->topic == TestTopicAttributes::topicName()) &&
+        (data->role == Report::Role::Subscriber)) {
+      report = *data;
+      report_received.release();
+    }
+  };
+  auto stats_subscriber = grape::ipc::Subscriber(grape::ipc::StatsTopic{}, stats_cb);
+
+  constexpr auto REPORT_PERIOD = std::chrono::milliseconds(100);
+  const auto reporter = grape::ipc::StatsReporter(REPORT_PERIOD);
+  constexpr auto REPORT_WAIT_TIME = std::chrono::seconds(2);
+  REQUIRE(report_received.try_acquire_for(REPORT_WAIT_TIME));
+
+  const auto lock = std::lock_guard(mutex);
+  REQUIRE(report->endpoint.id == subscriber.id());
+  REQUIRE(report->messages == 1);
+}
+
+//=================================================================================================
+TEST_CASE("Stats subscriber in this process may create and destroy endpoints", "[ipc]") {
+  grape::ipc::init(grape::ipc::Config{});
+
+  // reports are delivered on the reporting thread, which must not hold the endpoint registry
+  std::binary_semaphore report_received{ 0 };
+  const auto stats_cb = [&report_received](
+                            const std::expected<grape::ipc::EndpointStatsReport,
+                                                grape::ipc::Error>& /*data*/,
+                            const grape::ipc::SampleInfo& /*info*/) {
+    const auto publisher = grape::ipc::Publisher(TestTopicAttributes{});
+    report_received.release();
+  };
+  auto stats_subscriber = grape::ipc::Subscriber(grape::ipc::StatsTopic{}, stats_cb);
+
+  constexpr auto REPORT_PERIOD = std::chrono::milliseconds(100);
+  const auto reporter = grape::ipc::StatsReporter(REPORT_PERIOD);
+  constexpr auto REPORT_WAIT_TIME = std::chrono::seconds(2);
+  REQUIRE(report_received.try_acquire_for(REPORT_WAIT_TIME));
+}
+
+//=================================================================================================
+TEST_CASE("Subscriber rejects data published from a type of different layout", "[ipc]") {
+  grape::ipc::init(grape::ipc::Config{});
+
+  struct OtherDataType {
+    std::uint32_t id{};
+    std::string message;
+  };
+  STATIC_REQUIRE(grape::serdes::schemaHash<OtherDataType>() !=
+                 grape::serdes::schemaHash<TestDataType>());
+
+  auto error = std::optional<grape::ipc::Error>{};
+  std::binary_semaphore is_data_received{ 0 };
+  const auto data_cb = [&error, &is_data_received](
+                           const std::expected<TestDataType, grape::ipc::Error>& data,
+                           const grape::ipc::SampleInfo& /*info*/) {
+    if (not data) {
+      error = data.error();
+    }
+    is_data_received.release();
+  };
+  auto subscriber = grape::ipc::Subscriber(TestTopicAttributes{}, data_cb);
+
+  // publish from a type that is named like the topic data type but laid out differently
+  const auto other_topic = grape::ipc::Topic{
+    .name = TestTopicAttributes::topicName(),
+    .type_name = std::format("{}{}{:016x}", grape::utils::getTypeName<TestDataType>(),
+                             grape::ipc::SCHEMA_HASH_SEPARATOR,
+                             grape::serdes::schemaHash<OtherDataType>()),
+  };
+  auto publisher = grape::ipc::RawPublisher(other_topic);
+
+  constexpr auto RETRY_COUNT = 10U;
+  auto count_down = RETRY_COUNT;
+  while ((subscriber.publisherCount() == 0U) && (count_down > 0)) {
+    constexpr auto REG_WAIT_TIME = std::chrono::milliseconds(200);
+    std::this_thread::sleep_for(REG_WAIT_TIME);
+    count_down--;
+  }
+  REQUIRE(subscriber.publisherCount() == 1U);
+
+  auto stream = grape::serdes::ArenaOutStream{};
+  auto serialiser = grape::serdes::Serialiser(stream);
+  REQUIRE(serialiser.pack(OtherDataType{ .id = 1, .message = "hello" }));
+  REQUIRE(publisher.publish(stream.data()).has_value());
+
+  constexpr auto RECV_WAIT_TIME = std::chrono::milliseconds(1000);
+  REQUIRE(is_data_received.try_acquire_for(RECV_WAIT_TIME));
+  REQUIRE(error == grape::ipc::Error::SchemaMismatch);
+}
+
+//=================================================================================================
+TEST_CASE("Schema compatibility is checked only when both type names carry a schema hash",
+          "[ipc]") {
+  using grape::ipc::isSchemaCompatible;
+  STATIC_REQUIRE(isSchemaCompatible("Pose#00000000000000aa", "Pose#00000000000000aa"));
+  STATIC_REQUIRE(isSchemaCompatible("Pose#00000000000000aa", "Location#00000000000000aa"));
+  STATIC_REQUIRE(not isSchemaCompatible("Pose#00000000000000aa", "Pose#00000000000000bb"));
+  STATIC_REQUIRE(isSchemaCompatible("Pose#00000000000000aa", "Pose"));
+  STATIC_REQUIRE(isSchemaCompatible("bytes", "string"));
+}
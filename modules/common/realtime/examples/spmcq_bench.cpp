@@ -2,10 +2,14 @@
 // Copyright (C) 2026 GRAPE Contributors
 //=================================================================================================
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <cstring>
+#include <ctime>
 #include <format>
 #include <stdexcept>
+#include <thread>
 #include <vector>
 
 #include <benchmark/benchmark.h>
@@ -96,6 +100,262 @@ void bmSpmcqRead(benchmark::State& state) {
   }
 }
 
+//-------------------------------------------------------------------------------------------------
+// Writes and reads a batch of small frames one frame at a time. Baseline for bmSpmcqBatch.
+void bmSpmcqPerFrame(benchmark::State& state) {
+  const auto batch_size = static_cast<std::size_t>(state.range(0));
+  const auto shm_name = uniqueShmName();
+  const auto config =
+      Config{ .frame_length = sizeof(std::uint64_t), .num_frames = batch_size + 1U };
+  auto maybe_writer = Writer::create(shm_name, config);
+  if (not maybe_writer) {
+    throw std::runtime_error(std::string{ maybe_writer.error().message() });
+  }
+  auto maybe_reader = Reader::connect(shm_name);
+  if (not maybe_reader) {
+    throw std::runtime_error(std::string{ maybe_reader.error().message() });
+  }
+  auto& writer = maybe_writer.value();
+  auto& reader = maybe_reader.value();
+
+  auto value = std::uint64_t{ 0 };
+  const auto writer_fn = [&value](std::span<std::byte> frame) -> bool {
+    std::memcpy(frame.data(), &value, sizeof(value));
+    ++value;
+    return true;
+  };
+  auto sum = std::uint64_t{ 0 };
+  const auto reader_fn = [&sum](std::span<const std::byte> frame) -> bool {
+    std::uint64_t v{};
+    std::memcpy(&v, frame.data(), sizeof(v));
+    sum += v;
+    return true;
+  };
+
+  for (auto st : state) {
+    (void)st;
+    for (auto i = 0UZ; i < batch_size; ++i) {
+      writer.visit(writer_fn);
+    }
+    while (reader.visit(reader_fn) == Reader::Status::Ok) {
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+//-------------------------------------------------------------------------------------------------
+// Writes and reads a batch of small frames with a single counter update on each side
+void bmSpmcqBatch(benchmark::State& state) {
+  const auto batch_size = static_cast<std::size_t>(state.range(0));
+  const auto shm_name = uniqueShmName();
+  // one spare frame so that the write position moves around the ring between iterations
+  const auto config =
+      Config{ .frame_length = sizeof(std::uint64_t), .num_frames = batch_size + 1U };
+  auto maybe_writer = Writer::create(shm_name, config);
+  if (not maybe_writer) {
+    throw std::runtime_error(std::string{ maybe_writer.error().message() });
+  }
+  auto maybe_reader = Reader::connect(shm_name);
+  if (not maybe_reader) {
+    throw std::runtime_error(std::string{ maybe_reader.error().message() });
+  }
+  auto& writer = maybe_writer.value();
+  auto& reader = maybe_reader.value();
+
+  auto value = std::uint64_t{ 0 };
+  const auto writer_fn = [&value](std::span<std::byte> head, std::span<std::byte> tail) -> bool {
+    for (const auto region : { head, tail }) {
+      for (auto offset = 0UZ; offset < region.size_bytes(); offset += sizeof(value)) {
+        std::memcpy(region.subspan(offset).data(), &value, sizeof(value));
+        ++value;
+      }
+    }
+    return true;
+  };
+  auto sum = std::uint64_t{ 0 };
+  const auto reader_fn = [&sum](std::span<const std::byte> head,
+                                std::span<const std::byte> tail) -> bool {
+    for (const auto region : { head, tail }) {
+      for (auto offset = 0UZ; offset < region.size_bytes(); offset += sizeof(std::uint64_t)) {
+        std::uint64_t v{};
+        std::memcpy(&v, region.subspan(offset).data(), sizeof(v));
+        sum += v;
+      }
+    }
+    return true;
+  };
+
+  for (auto st : state) {
+    (void)st;
+    if (not writer.visitBatch(batch_size, writer_fn)) {
+      throw std::runtime_error("batch write failed");
+    }
+    if (reader.visitRange(reader_fn) != Reader::Status::Ok) {
+      throw std::runtime_error("ranged read failed");
+    }
+    benchmark::DoNotOptimize(sum);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+//-------------------------------------------------------------------------------------------------
+// Reads the latest frame while another thread writes into a small ring at a fixed pace, and
+// reports the fraction of reads invalidated as Dropped. Compares lap detection on the shared write
+// counter against per-frame version words (Config::versioned) for a range of frame sizes. Larger
+// frames take longer to copy, so are more likely to see the writer move on during the read.
+void bmSpmcqDropRate(benchmark::State& state) {
+  const auto data_size = static_cast<std::size_t>(state.range(0));
+  const auto versioned = (state.range(1) != 0);
+  const auto shm_name = uniqueShmName();
+  static constexpr auto CAPACITY = 2UZ;
+  const auto config =
+      Config{ .frame_length = data_size, .num_frames = CAPACITY, .versioned = versioned };
+
+  auto maybe_writer = Writer::create(shm_name, config);
+  if (not maybe_writer) {
+    throw std::runtime_error(std::string{ maybe_writer.error().message() });
+  }
+  auto maybe_reader = Reader::connect(shm_name);
+  if (not maybe_reader) {
+    throw std::runtime_error(std::string{ maybe_reader.error().message() });
+  }
+  auto& writer = maybe_writer.value();
+  auto& reader = maybe_reader.value();
+
+  auto producer = std::jthread([&writer, data_size](const std::stop_token& st) {
+    std::vector<std::byte> data(data_size);
+    const auto writer_fn = [&data](std::span<std::byte> frame) -> bool {
+      std::memcpy(frame.data(), data.data(), data.size());
+      return true;
+    };
+    static constexpr auto WRITE_PERIOD = std::chrono::microseconds(5);
+    while (not st.stop_requested()) {
+      writer.visit(writer_fn);
+      std::this_thread::sleep_for(WRITE_PERIOD);
+    }
+  });
+
+  std::vector<std::byte> data(data_size);
+  const auto reader_fn = [&data](std::span<const std::byte> frame) -> bool {
+    std::memcpy(data.data(), frame.data(), frame.size_bytes());
+    return true;
+  };
+
+  auto num_ok = 0UZ;
+  auto num_dropped = 0UZ;
+  for (auto st : state) {
+    (void)st;
+    const auto status = reader.visit(reader_fn, Reader::Policy::Latest);
+    num_ok += (status == Reader::Status::Ok) ? 1U : 0U;
+    num_dropped += (status == Reader::Status::Dropped) ? 1U : 0U;
+    benchmark::ClobberMemory();
+  }
+  producer.request_stop();
+  producer.join();
+
+  static constexpr auto PERCENT = 100.;
+  const auto num_reads = std::max(num_ok + num_dropped, 1UZ);
+  state.counters["dropped_%"] =
+      PERCENT * static_cast<double>(num_dropped) / static_cast<double>(num_reads);
+  state.SetItemsProcessed(static_cast<std::int64_t>(num_ok));
+  state.SetLabel(versioned ? "versioned" : "unversioned");
+}
+
+//-------------------------------------------------------------------------------------------------
+// How the reader waits for new frames in bmSpmcqWakeup
+enum class WaitMode : std::uint8_t {
+  Poll,   //!< Spin on Reader::visit()
+  Block,  //!< Sleep in Reader::waitVisit()
+};
+
+//-------------------------------------------------------------------------------------------------
+auto steadyNanos() -> std::int64_t {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+//-------------------------------------------------------------------------------------------------
+auto threadCpuNanos() -> std::int64_t {
+  static constexpr auto NANOS_PER_SEC = 1'000'000'000L;
+  auto ts = timespec{};
+  ::clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+  return (ts.tv_sec * NANOS_PER_SEC) + ts.tv_nsec;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Measures wake-up latency (write to read-callback) of a reader in another thread, and the CPU
+// consumed by that reader while it waits for frames written at a low rate.
+void bmSpmcqWakeup(benchmark::State& state) {
+  const auto mode = static_cast<WaitMode>(state.range(0));
+  const auto shm_name = uniqueShmName();
+  const auto config = Config{ .frame_length = sizeof(std::int64_t), .num_frames = 16U };
+
+  auto maybe_writer = Writer::create(shm_name, config);
+  if (not maybe_writer) {
+    throw std::runtime_error(std::string{ maybe_writer.error().message() });
+  }
+  auto maybe_reader = Reader::connect(shm_name);
+  if (not maybe_reader) {
+    throw std::runtime_error(std::string{ maybe_reader.error().message() });
+  }
+  auto& writer = maybe_writer.value();
+  auto& reader = maybe_reader.value();
+
+  std::atomic<std::uint64_t> num_reads{ 0 };
+  std::atomic<std::int64_t> latency_ns{ 0 };
+  std::atomic<std::int64_t> reader_cpu_ns{ 0 };
+
+  auto consumer = std::jthread([&](const std::stop_token& st) {
+    static constexpr auto WAIT_TIMEOUT = std::chrono::milliseconds(10);
+    const auto reader_fn = [&latency_ns](std::span<const std::byte> frame) -> bool {
+      std::int64_t write_ts{};
+      std::memcpy(&write_ts, frame.data(), sizeof(write_ts));
+      latency_ns.store(steadyNanos() - write_ts, std::memory_order_relaxed);
+      return true;
+    };
+    const auto cpu_start = threadCpuNanos();
+    while (not st.stop_requested()) {
+      const auto status = (mode == WaitMode::Poll) ? reader.visit(reader_fn) :
+                                                     reader.waitVisit(reader_fn, WAIT_TIMEOUT);
+      if (status == Reader::Status::Ok) {
+        num_reads.fetch_add(1U, std::memory_order_release);
+      }
+    }
+    reader_cpu_ns.store(threadCpuNanos() - cpu_start);
+  });
+
+  const auto writer_fn = [](std::span<std::byte> frame) -> bool {
+    const auto ts = steadyNanos();
+    std::memcpy(frame.data(), &ts, sizeof(ts));
+    return true;
+  };
+
+  // Writes are spaced out so that the reader spends most of its time waiting
+  static constexpr auto WRITE_PERIOD = std::chrono::microseconds(200);
+  const auto wall_start = steadyNanos();
+  for (auto st : state) {
+    (void)st;
+    std::this_thread::sleep_for(WRITE_PERIOD);
+    const auto target = num_reads.load(std::memory_order_acquire) + 1U;
+    writer.visit(writer_fn);
+    while (num_reads.load(std::memory_order_acquire) < target) {
+    }
+    static constexpr auto SECS_PER_NANO = 1e-9;
+    state.SetIterationTime(static_cast<double>(latency_ns.load(std::memory_order_relaxed)) *
+                           SECS_PER_NANO);
+  }
+  consumer.request_stop();
+  consumer.join();
+  const auto wall_ns = steadyNanos() - wall_start;
+
+  static constexpr auto PERCENT = 100.;
+  state.counters["reader_cpu_%"] = PERCENT * static_cast<double>(reader_cpu_ns.load()) /
+                                   static_cast<double>(wall_ns);
+  state.SetLabel(mode == WaitMode::Poll ? "poll" : "block");
+}
+
 constexpr auto MAX_ITERATIONS = 1000000U;
 constexpr auto DATA_SIZE_MULT = 2U;
 constexpr auto DATA_SIZE_MIN = 8;
@@ -111,6 +371,32 @@ BENCHMARK(bmSpmcqRead)
     ->Range(DATA_SIZE_MIN, DATA_SIZE_MAX)
     ->Iterations(MAX_ITERATIONS);
 
+constexpr auto DROP_SIZE_MULT = 8;
+constexpr auto DROP_SIZE_MAX = 64 * 1024;
+
+BENCHMARK(bmSpmcqDropRate)
+    ->ArgsProduct({ benchmark::CreateRange(DATA_SIZE_MIN, DROP_SIZE_MAX, DROP_SIZE_MULT),
+                    { 0, 1 } })
+    ->UseRealTime();
+
+constexpr auto BATCH_SIZE_MULT = 4;
+constexpr auto BATCH_SIZE_MIN = 1;
+constexpr auto BATCH_SIZE_MAX = 4096;
+
+BENCHMARK(bmSpmcqPerFrame)
+    ->RangeMultiplier(BATCH_SIZE_MULT)
+    ->Range(BATCH_SIZE_MIN, BATCH_SIZE_MAX);
+
+BENCHMARK(bmSpmcqBatch)->RangeMultiplier(BATCH_SIZE_MULT)->Range(BATCH_SIZE_MIN, BATCH_SIZE_MAX);
+
+constexpr auto WAKEUP_ITERATIONS = 5000U;
+
+BENCHMARK(bmSpmcqWakeup)
+    ->Arg(static_cast<std::int64_t>(WaitMode::Poll))
+    ->Arg(static_cast<std::int64_t>(WaitMode::Block))
+    ->Iterations(WAKEUP_ITERATIONS)
+    ->UseManualTime();
+
 }  // namespace
 
 BENCHMARK_MAIN();
@@ -4,7 +4,9 @@
 
 #pragma once
 
+#include <algorithm>  // for min, max
 #include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <expected>
@@ -17,6 +19,7 @@
 #include <utility>      // for forward
 
 #include "grape/error.h"
+#include "grape/shared_memory.h"
 #include "grape/utils/enums.h"
 
 //=================================================================================================
@@ -29,6 +32,9 @@
 /// - Multiple independent Readers are supported, each tracking their own read position.
 /// - Readers can reside in different processes on the same host.
 /// - A Reader that falls too far behind will have frames dropped to catch up.
+/// - Readers may either poll for new frames (Reader::visit) or block until the Writer publishes a
+///   frame (Reader::waitVisit). The Writer only issues a wake-up system call when at least one
+///   Reader is blocked.
 //=================================================================================================
 
 namespace grape::spmcq {
@@ -40,8 +46,21 @@ struct Config {
   static constexpr auto MIN_FRAMES = 2U;
   std::size_t frame_length{ MIN_FRAME_LENGTH };  //!< Length of a single frame in bytes
   std::size_t num_frames{ MIN_FRAMES };          //!< Number of frames in the buffer
+  bool versioned{ false };  //!< Guard each frame with its own version word. See Reader::visit()
+  SharedMemory::Options memory{};  //!< Page size, pre-faulting and NUMA placement of the buffer
 };
 
+namespace detail {
+
+/// Per-frame header used when Config::versioned is set. The version of a frame is odd while the
+/// writer is modifying it and even once written. Headers are padded to a (typical) cache line so
+/// that the writer updating one frame does not contend with readers validating adjacent frames.
+struct alignas(64) FrameHeader {
+  std::uint64_t version{};
+};
+
+}  // namespace detail
+
 //=================================================================================================
 /// Creates a ring buffer and provides methods to write data to it
 ///
@@ -69,6 +88,25 @@ public:
     requires std::is_invocable_r_v<bool, F, std::span<std::byte>>
   void visit(F&& fn);
 
+  /// Write a batch of consecutive frames in-place and publish them to readers at once.
+  ///
+  /// Frames are laid out back-to-back in the ring. The batch is presented as at most two
+  /// contiguous regions, split where the batch wraps around the end of the ring. Readers see
+  /// either none or all of the frames in the batch.
+  ///
+  /// @param n Number of frames in the batch. Must be in the range [1, Config::num_frames]
+  /// @param fn User-defined callable invoked with writable views of the batch.
+  ///           Callable function signature:
+  ///           `fn(std::span<std::byte> head, std::span<std::byte> tail) -> bool`, where `head`
+  ///           holds the first frames of the batch and `tail` (empty if the batch does not wrap)
+  ///           holds the rest. Each region size is a multiple of Config::frame_length.
+  ///           Return `false` to abort the write without advancing the write counter.
+  /// @return true if the batch was published. false if n is out of range or fn aborted the write
+  /// @note Must not be called concurrently.
+  template <typename F>
+    requires std::is_invocable_r_v<bool, F, std::span<std::byte>, std::span<std::byte>>
+  auto visitBatch(std::size_t n, F&& fn) -> bool;
+
   ~Writer();
   Writer(Writer&& other) noexcept = default;
   auto operator=(Writer&& other) noexcept -> Writer& = default;
@@ -78,12 +116,20 @@ public:
 private:
   struct Impl;
   explicit Writer(std::string name, std::unique_ptr<Impl> impl, const Config& config,
-                  std::span<std::byte> frames, std::uint64_t* write_count_ptr);
+                  std::span<std::byte> frames, std::span<detail::FrameHeader> headers,
+                  std::uint64_t* write_count_ptr, std::uint64_t* reserve_count_ptr,
+                  std::uint32_t* waiters_ptr);
+  void setVersion(std::uint64_t count, bool writing);
+  void publish(std::uint64_t num_frames);
+  void notify();
   std::string name_;
   std::unique_ptr<Impl> impl_;
   Config config_;
   std::span<std::byte> frames_;
+  std::span<detail::FrameHeader> headers_;  //!< empty unless config_.versioned
   std::uint64_t* write_count_ptr_{};
+  std::uint64_t* reserve_count_ptr_{};
+  std::uint32_t* waiters_ptr_{};
 };
 
 //=================================================================================================
@@ -110,6 +156,8 @@ public:
   [[nodiscard]] static auto exists(std::string_view name) -> bool;
 
   /// Open an existing buffer for reading.
+  /// @note The control block is mapped with write access so that blocked readers can register
+  /// themselves with the writer (see waitVisit()). Frame data is only ever accessed read-only.
   /// @param name Identifying name of the buffer
   /// @return A Reader on success, or an error if the buffer does not exist or is incompatible
   [[nodiscard]] static auto connect(std::string_view name) -> std::expected<Reader, Error>;
@@ -126,6 +174,11 @@ public:
   /// data. The data in this case should be assumed to be invalid. The next call will attempt to
   /// read from the new position.
   ///
+  /// Without Config::versioned, a read is invalidated when the writer has advanced far enough
+  /// that it may have started overwriting the frame, even if it has not actually touched it yet.
+  /// With Config::versioned, the reader instead validates the version word of exactly the frame
+  /// it read (seqlock), and only reports Status::Dropped if that frame was modified.
+  ///
   /// @param fn User-defined callable invoked with a read-only view of the frame.
   ///           Callbable function signature `fn(std::span<const std::byte>) -> bool`.
   ///           Return `false` to abort the read without advancing the read counter.
@@ -136,6 +189,40 @@ public:
     requires std::is_invocable_r_v<bool, F, std::span<const std::byte>>
   [[nodiscard]] auto visit(F&& fn, Policy policy = Policy::Next) -> Status;
 
+  /// Read all unread frames in-place in a single operation.
+  ///
+  /// The unread frames are presented as at most two contiguous regions, split where they wrap
+  /// around the end of the ring. The check for being lapped by the writer is done once for the
+  /// whole range rather than per frame.
+  ///
+  /// @param fn User-defined callable invoked with read-only views of the unread frames.
+  ///           Callable function signature:
+  ///           `fn(std::span<const std::byte> head, std::span<const std::byte> tail) -> bool`,
+  ///           where `head` holds the oldest unread frames and `tail` (empty if the range does
+  ///           not wrap) holds the rest. Each region size is a multiple of Config::frame_length.
+  ///           Return `false` to abort the read without advancing the read counter.
+  /// @return read status. Status::Ok if all unread frames were read successfully
+  /// @note Must not be called concurrently.
+  template <typename F>
+    requires std::is_invocable_r_v<bool, F, std::span<const std::byte>, std::span<const std::byte>>
+  [[nodiscard]] auto visitRange(F&& fn) -> Status;
+
+  /// Block until the writer publishes a frame that this reader has not yet seen, then read it
+  /// in-place as visit() would.
+  ///
+  /// The reader sleeps on a futex in the shared control block instead of spinning, and is woken
+  /// up by the writer. Returns immediately if unread frames are already available.
+  ///
+  /// @param fn User-defined callable. See visit()
+  /// @param timeout Maximum time to wait for a new frame
+  /// @param policy Policy to apply for reading
+  /// @return read status. Status::Empty if no new frame was published within timeout
+  /// @note Must not be called concurrently.
+  template <typename F>
+    requires std::is_invocable_r_v<bool, F, std::span<const std::byte>>
+  [[nodiscard]] auto waitVisit(F&& fn, std::chrono::milliseconds timeout,
+                               Policy policy = Policy::Next) -> Status;
+
   ~Reader();
   Reader(Reader&& other) noexcept = default;
   auto operator=(Reader&& other) noexcept -> Reader& = default;
@@ -146,12 +233,24 @@ private:
   struct Impl;
   explicit Reader(std::unique_ptr<Impl> impl, const Config& config,
                   std::span<const std::byte> metadata, std::span<const std::byte> frames,
-                  const std::uint64_t* write_count_ptr);
+                  std::span<const detail::FrameHeader> headers,
+                  const std::uint64_t* write_count_ptr, const std::uint64_t* reserve_count_ptr,
+                  std::uint32_t* waiters_ptr);
+  [[nodiscard]] auto waitForWrite(std::chrono::steady_clock::time_point deadline) -> bool;
+  [[nodiscard]] auto writeCount() const -> std::uint64_t;
+  [[nodiscard]] auto overwriteCount() const -> std::uint64_t;
+  [[nodiscard]] auto maxReadLag() const -> std::uint64_t;
+  [[nodiscard]] auto version(std::uint64_t count) const -> std::uint64_t;
+  [[nodiscard]] auto isOverwritten(std::uint64_t count, std::uint64_t version_pre_read) const
+      -> bool;
   std::unique_ptr<Impl> impl_;
   Config config_;
   std::span<const std::byte> metadata_;
   std::span<const std::byte> frames_;
+  std::span<const detail::FrameHeader> headers_;  //!< empty unless config_.versioned
   const std::uint64_t* write_count_ptr_{};
+  const std::uint64_t* reserve_count_ptr_{};
+  std::uint32_t* waiters_ptr_{};
   std::uint64_t read_count_{};
 };
 
@@ -162,8 +261,78 @@ void Writer::visit(F&& fn) {
   const auto wc_ref = std::atomic_ref<std::uint64_t>{ *write_count_ptr_ };
   const auto write_count = wc_ref.load(std::memory_order_relaxed);
   const auto frame_start = (write_count % config_.num_frames) * config_.frame_length;
+  if (not headers_.empty()) {
+    setVersion(write_count, true);
+  }
   if (std::invoke(std::forward<F>(fn), frames_.subspan(frame_start, config_.frame_length))) {
-    wc_ref.fetch_add(1U, std::memory_order_release);
+    if (not headers_.empty()) {
+      setVersion(write_count, false);
+    }
+    publish(1U);
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+template <typename F>
+  requires std::is_invocable_r_v<bool, F, std::span<std::byte>, std::span<std::byte>>
+auto Writer::visitBatch(std::size_t n, F&& fn) -> bool {
+  if ((n == 0U) or (n > config_.num_frames)) {
+    return false;
+  }
+  const auto wc_ref = std::atomic_ref<std::uint64_t>{ *write_count_ptr_ };
+  const auto write_count = wc_ref.load(std::memory_order_relaxed);
+
+  // Announce the frames about to be overwritten before touching them, so that readers can detect
+  // that their data was clobbered even though write_count has not moved yet (see Reader)
+  std::atomic_ref<std::uint64_t>{ *reserve_count_ptr_ }.store(write_count + n,
+                                                              std::memory_order_relaxed);
+  if (not headers_.empty()) {
+    for (auto i = 0UZ; i < n; ++i) {
+      setVersion(write_count + i, true);
+    }
+  }
+  std::atomic_thread_fence(std::memory_order_release);
+
+  const auto first_frame = write_count % config_.num_frames;
+  const auto head_frames = std::min(n, config_.num_frames - first_frame);
+  const auto head = frames_.subspan(first_frame * config_.frame_length,
+                                    head_frames * config_.frame_length);
+  const auto tail = frames_.first((n - head_frames) * config_.frame_length);
+  if (not std::invoke(std::forward<F>(fn), head, tail)) {
+    return false;
+  }
+  if (not headers_.empty()) {
+    for (auto i = 0UZ; i < n; ++i) {
+      setVersion(write_count + i, false);
+    }
+  }
+  publish(n);
+  return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+inline void Writer::setVersion(std::uint64_t count, bool writing) {
+  // Odd while frame 'count' is being written, even (and unique to 'count') once written. Marking
+  // a frame as being written is followed by a release fence so the mark is visible to readers
+  // before any of the frame data is modified.
+  const auto version_ref =
+      std::atomic_ref<std::uint64_t>{ headers_[count % config_.num_frames].version };
+  if (writing) {
+    version_ref.store((2U * count) + 1U, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+  } else {
+    version_ref.store((2U * count) + 2U, std::memory_order_release);
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+inline void Writer::publish(std::uint64_t num_frames) {
+  // seq_cst orders the increment before the waiter check below, so that a reader registering
+  // itself as a waiter concurrently either observes the new count or gets woken up
+  std::atomic_ref<std::uint64_t>{ *write_count_ptr_ }.fetch_add(num_frames,
+                                                                std::memory_order_seq_cst);
+  if (std::atomic_ref<std::uint32_t>{ *waiters_ptr_ }.load(std::memory_order_seq_cst) != 0U) {
+    notify();
   }
 }
 
@@ -171,12 +340,7 @@ void Writer::visit(F&& fn) {
 template <typename F>
   requires std::is_invocable_r_v<bool, F, std::span<const std::byte>>
 [[nodiscard]] auto Reader::visit(F&& fn, Policy policy) -> Status {
-  // NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
-  const auto wc_ref =
-      std::atomic_ref<std::uint64_t>{ *const_cast<std::uint64_t*>(write_count_ptr_) };
-  // NOLINTEND(cppcoreguidelines-pro-type-const-cast)
-
-  const auto write_count = wc_ref.load(std::memory_order_acquire);
+  const auto write_count = writeCount();
 
   if (policy == Policy::Latest) {
     read_count_ = ((write_count > 0UL) ? (write_count - 1UL) : 0UL);
@@ -184,15 +348,24 @@ template <typename F>
 
   // To read a valid frame, read count should be within the following bounds:
   // (write_count - capacity) < read_count < write_count
+  // Versioned frames also allow read_count == (write_count - capacity), i.e. the frame the writer
+  // will overwrite next, since the version check below catches the writer actually doing so.
 
   // if writer lapped reader, fast-forward read count and report dropped frames
   const auto read_lag = write_count - read_count_;
-  const auto frame_good = ((read_lag < config_.num_frames) and (read_count_ < write_count));
+  const auto frame_good = ((read_lag < maxReadLag()) and (read_count_ < write_count));
   if (not frame_good) {
     read_count_ = write_count;
     return (read_lag == 0UL) ? Status::Empty : Status::Dropped;
   }
 
+  // a versioned frame that no longer holds 'read_count_' was overwritten after the check above
+  const auto version_pre_read = version(read_count_);
+  if ((not headers_.empty()) and (version_pre_read != (2U * read_count_) + 2U)) {
+    read_count_ = writeCount();
+    return Status::Dropped;
+  }
+
   // call user function
   const auto frame_start = (read_count_ % config_.num_frames) * config_.frame_length;
   if (not std::invoke(std::forward<F>(fn), frames_.subspan(frame_start, config_.frame_length))) {
@@ -200,15 +373,115 @@ template <typename F>
   }
 
   // if writer lapped reader while calling user function, invalidate the read
-  const auto write_count_post_read = wc_ref.load(std::memory_order_acquire);
-  if ((write_count_post_read - read_count_) >= config_.num_frames) {
-    read_count_ = write_count_post_read;
+  if (isOverwritten(read_count_, version_pre_read)) {
+    read_count_ = writeCount();
     return Status::Dropped;
   }
   read_count_++;
   return Status::Ok;
 }
 
+//-------------------------------------------------------------------------------------------------
+template <typename F>
+  requires std::is_invocable_r_v<bool, F, std::span<const std::byte>, std::span<const std::byte>>
+[[nodiscard]] auto Reader::visitRange(F&& fn) -> Status {
+  const auto write_count = writeCount();
+  const auto read_lag = write_count - read_count_;
+  if ((read_lag == 0UL) or (read_lag >= maxReadLag())) {
+    read_count_ = write_count;
+    return (read_lag == 0UL) ? Status::Empty : Status::Dropped;
+  }
+  const auto version_pre_read = version(read_count_);
+  if ((not headers_.empty()) and (version_pre_read != (2U * read_count_) + 2U)) {
+    read_count_ = writeCount();
+    return Status::Dropped;
+  }
+
+  const auto first_frame = read_count_ % config_.num_frames;
+  const auto head_frames = std::min(read_lag, config_.num_frames - first_frame);
+  const auto head = frames_.subspan(first_frame * config_.frame_length,
+                                    head_frames * config_.frame_length);
+  const auto tail = frames_.first((read_lag - head_frames) * config_.frame_length);
+  if (not std::invoke(std::forward<F>(fn), head, tail)) {
+    return Status::Canceled;
+  }
+
+  // The oldest frame in the range is the first to be overwritten, so one check covers them all
+  if (isOverwritten(read_count_, version_pre_read)) {
+    read_count_ = writeCount();
+    return Status::Dropped;
+  }
+  read_count_ = write_count;
+  return Status::Ok;
+}
+
+//-------------------------------------------------------------------------------------------------
+inline auto Reader::writeCount() const -> std::uint64_t {
+  // NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
+  return std::atomic_ref<std::uint64_t>{ *const_cast<std::uint64_t*>(write_count_ptr_) }.load(
+      std::memory_order_acquire);
+  // NOLINTEND(cppcoreguidelines-pro-type-const-cast)
+}
+
+//-------------------------------------------------------------------------------------------------
+inline auto Reader::overwriteCount() const -> std::uint64_t {
+  // Called after reading frame data. Returns an upper bound on the frames the writer has started
+  // to write, including a batch that may still be in progress (see Writer::visitBatch)
+  std::atomic_thread_fence(std::memory_order_acquire);
+  // NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
+  const auto write_count =
+      std::atomic_ref<std::uint64_t>{ *const_cast<std::uint64_t*>(write_count_ptr_) }.load(
+          std::memory_order_relaxed);
+  const auto reserve_count =
+      std::atomic_ref<std::uint64_t>{ *const_cast<std::uint64_t*>(reserve_count_ptr_) }.load(
+          std::memory_order_relaxed);
+  // NOLINTEND(cppcoreguidelines-pro-type-const-cast)
+  return std::max(write_count, reserve_count);
+}
+
+//-------------------------------------------------------------------------------------------------
+inline auto Reader::maxReadLag() const -> std::uint64_t {
+  return headers_.empty() ? config_.num_frames : config_.num_frames + 1U;
+}
+
+//-------------------------------------------------------------------------------------------------
+inline auto Reader::version(std::uint64_t count) const -> std::uint64_t {
+  if (headers_.empty()) {
+    return 0U;
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  auto& header = const_cast<detail::FrameHeader&>(headers_[count % config_.num_frames]);
+  return std::atomic_ref<std::uint64_t>{ header.version }.load(std::memory_order_acquire);
+}
+
+//-------------------------------------------------------------------------------------------------
+inline auto Reader::isOverwritten(std::uint64_t count, std::uint64_t version_pre_read) const
+    -> bool {
+  // Called after reading frame data
+  if (headers_.empty()) {
+    return (overwriteCount() - count) >= config_.num_frames;
+  }
+  std::atomic_thread_fence(std::memory_order_acquire);
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  auto& header = const_cast<detail::FrameHeader&>(headers_[count % config_.num_frames]);
+  return std::atomic_ref<std::uint64_t>{ header.version }.load(std::memory_order_relaxed) !=
+         version_pre_read;
+}
+
+//-------------------------------------------------------------------------------------------------
+template <typename F>
+  requires std::is_invocable_r_v<bool, F, std::span<const std::byte>>
+[[nodiscard]] auto Reader::waitVisit(F&& fn, std::chrono::milliseconds timeout, Policy policy)
+    -> Status {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (not waitForWrite(deadline)) {
+    if (std::chrono::steady_clock::now() >= deadline) {
+      return Status::Empty;
+    }
+  }
+  return visit(std::forward<F>(fn), policy);
+}
+
 //-------------------------------------------------------------------------------------------------
 [[nodiscard]] constexpr auto toString(Reader::Status st) -> std::string_view {
   return enums::name(st);
@@ -0,0 +1,373 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#pragma once
+
+#include <algorithm>  // for max
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <functional>
+#include <memory>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>  // for is_invocable_r_v
+#include <utility>      // for forward
+
+#include "grape/error.h"
+#include "grape/realtime/spmcq.h"
+
+//=================================================================================================
+/// Single-producer multi-consumer lock-free ring buffer of variable-length records over shared
+/// memory.
+///
+/// Where spmcq::Writer and spmcq::Reader exchange fixed-size frames, VarWriter and VarReader
+/// exchange records of any length up to the buffer capacity, packed back-to-back in a byte ring.
+/// This suits payloads whose size varies widely between messages (compressed images, strings),
+/// for which fixed frames would have to be sized for the worst case.
+///
+/// - Each record is prefixed with a header holding its length and a sequence number.
+/// - Records never straddle the end of the ring. If a record does not fit in the space remaining
+///   before the end, the writer marks that space as padding and wraps to the beginning.
+/// - A record (with its header) can occupy at most half the ring, so that a record never
+///   overwrites the padding that precedes it.
+/// - Otherwise, semantics are the same as the fixed-frame buffer: a single non-blocking Writer,
+///   multiple independent Readers, and Readers lapped by the Writer drop records to catch up
+///   (Reader::Status::Dropped).
+//=================================================================================================
+
+namespace grape::spmcq {
+
+//-------------------------------------------------------------------------------------------------
+/// Variable-length record buffer configuration options
+struct VarConfig {
+  static constexpr auto RECORD_ALIGNMENT = 16U;  //!< Records start at multiples of this
+  static constexpr auto MIN_CAPACITY = 4U * RECORD_ALIGNMENT;
+  std::size_t capacity{ MIN_CAPACITY };  //!< Size of the byte ring. Multiple of RECORD_ALIGNMENT
+  SharedMemory::Options memory{};  //!< Page size, pre-faulting and NUMA placement of the buffer
+};
+
+namespace detail {
+
+/// Header preceding every record in the ring
+struct VarRecordHeader {
+  static constexpr auto PADDING = ~std::uint64_t{ 0 };  //!< length marking skipped space
+  std::uint64_t sequence{};                             //!< Record number, starting at 1
+  std::uint64_t length{};                               //!< Payload length in bytes
+};
+static_assert(sizeof(VarRecordHeader) <= VarConfig::RECORD_ALIGNMENT);
+
+/// Ring state shared by the writer and readers through the control block
+struct VarCounters {
+  std::uint64_t write_pos{};    //!< Bytes published. Always at a record boundary
+  std::uint64_t reserve_pos{};  //!< End of the bytes being overwritten by an in-progress write
+  std::uint64_t latest_pos{};   //!< Start of the most recently published record
+  std::uint32_t waiters{};      //!< Number of readers blocked waiting on write_pos
+};
+
+/// @return Bytes occupied in the ring by a record with payload of given length
+[[nodiscard]] constexpr auto varRecordSize(std::size_t length) -> std::size_t {
+  constexpr auto ALIGN = VarConfig::RECORD_ALIGNMENT;
+  return (ALIGN + length + ALIGN - 1U) & ~(ALIGN - 1U);
+}
+
+}  // namespace detail
+
+//=================================================================================================
+/// Creates a variable-length record ring buffer and provides methods to write records into it
+///
+class VarWriter {
+public:
+  /// Creates ring buffer and returns buffer writer. Method fails if a writer already exists
+  /// @param name A uniquely identifying name for the ring buffer
+  /// @param config Buffer configuration parameters
+  /// @param metadata (Optional) Static user-defined data shared with readers
+  /// @return A writer to write data into buffer, or an error message
+  [[nodiscard]] static auto create(std::string_view name, const VarConfig& config,
+                                   std::span<const std::byte> metadata = {})
+      -> std::expected<VarWriter, Error>;
+
+  /// @return Maximum payload length of a single record (a little under half the capacity)
+  [[nodiscard]] auto maxRecordLength() const -> std::size_t;
+
+  /// Write a record in-place.
+  ///
+  /// @param max_length Upper bound on the record length. Space for this many bytes is reserved
+  ///        in the ring, but only the length actually written is consumed.
+  /// @param fn User-defined callable invoked with a writable view of `max_length` bytes.
+  ///           Callable function signature: `fn(std::span<std::byte>) -> std::size_t`.
+  ///           Return the number of bytes written, or 0 to abort the write.
+  /// @return true if the record was published. false if max_length exceeds maxRecordLength(), or
+  ///         fn aborted the write or returned a length larger than max_length.
+  /// @note Must not be called concurrently.
+  /// @note Operation does not block waiting for slow Readers. Therefore, Writer can 'lap' a Reader
+  ///       forcing the Reader to drop records.
+  template <typename F>
+    requires std::is_invocable_r_v<std::size_t, F, std::span<std::byte>>
+  auto visit(std::size_t max_length, F&& fn) -> bool;
+
+  ~VarWriter();
+  VarWriter(VarWriter&& other) noexcept = default;
+  auto operator=(VarWriter&& other) noexcept -> VarWriter& = default;
+  VarWriter(const VarWriter&) = delete;
+  auto operator=(const VarWriter&) -> VarWriter& = delete;
+
+private:
+  using RecordHeader = detail::VarRecordHeader;
+  using Counters = detail::VarCounters;
+  struct Impl;
+  explicit VarWriter(std::string name, std::unique_ptr<Impl> impl, const VarConfig& config,
+                     std::span<std::byte> ring, Counters* counters);
+  void notify();
+  std::string name_;
+  std::unique_ptr<Impl> impl_;
+  VarConfig config_;
+  std::span<std::byte> ring_;
+  Counters* counters_{};
+  std::uint64_t sequence_{ 1 };
+};
+
+//=================================================================================================
+/// Connects to an existing variable-length record ring buffer to read data.
+class VarReader {
+public:
+  using Policy = Reader::Policy;
+  using Status = Reader::Status;
+
+  /// Check if a buffer exists
+  /// @param name Identifying name of the buffer
+  /// @return true if buffer exists
+  [[nodiscard]] static auto exists(std::string_view name) -> bool;
+
+  /// Open an existing buffer for reading.
+  /// @note The control block is mapped with write access so that blocked readers can register
+  /// themselves with the writer (see waitVisit()). Record data is only ever accessed read-only.
+  /// @param name Identifying name of the buffer
+  /// @return A VarReader on success, or an error if the buffer does not exist or is incompatible
+  [[nodiscard]] static auto connect(std::string_view name) -> std::expected<VarReader, Error>;
+
+  /// @return buffer configuration parameters
+  [[nodiscard]] auto config() const -> VarConfig;
+
+  /// @return static user data associated with the buffer
+  [[nodiscard]] auto metadata() const -> std::span<const std::byte>;
+
+  /// @return Sequence number of the last record read successfully (records are numbered from 1,
+  /// and 0 means none read yet). Gaps between consecutive values indicate the number of records
+  /// skipped (Policy::Latest) or dropped.
+  [[nodiscard]] auto sequence() const -> std::uint64_t;
+
+  /// Attempt to read the next unread record in-place.
+  ///
+  /// If the writer has lapped this reader, the reader drops records and fast-forwards to the next
+  /// record to be written.
+  ///
+  /// @param fn User-defined callable invoked with a read-only view of the record payload.
+  ///           Callable function signature `fn(std::span<const std::byte>) -> bool`.
+  ///           Return `false` to abort the read without advancing the read position.
+  /// @param policy Policy to apply for reading
+  /// @return read status
+  /// @note Must not be called concurrently.
+  template <typename F>
+    requires std::is_invocable_r_v<bool, F, std::span<const std::byte>>
+  [[nodiscard]] auto visit(F&& fn, Policy policy = Policy::Next) -> Status;
+
+  /// Block until the writer publishes a record that this reader has not yet seen, then read it
+  /// in-place as visit() would.
+  ///
+  /// @param fn User-defined callable. See visit()
+  /// @param timeout Maximum time to wait for a new record
+  /// @param policy Policy to apply for reading
+  /// @return read status. Status::Empty if no new record was published within timeout
+  /// @note Must not be called concurrently.
+  template <typename F>
+    requires std::is_invocable_r_v<bool, F, std::span<const std::byte>>
+  [[nodiscard]] auto waitVisit(F&& fn, std::chrono::milliseconds timeout,
+                               Policy policy = Policy::Next) -> Status;
+
+  ~VarReader();
+  VarReader(VarReader&& other) noexcept = default;
+  auto operator=(VarReader&& other) noexcept -> VarReader& = default;
+  VarReader(const VarReader&) = delete;
+  auto operator=(const VarReader&) -> VarReader& = delete;
+
+private:
+  using RecordHeader = detail::VarRecordHeader;
+  using Counters = detail::VarCounters;
+  struct Impl;
+  explicit VarReader(std::unique_ptr<Impl> impl, const VarConfig& config,
+                     std::span<const std::byte> metadata, std::span<const std::byte> ring,
+                     Counters* counters);
+  [[nodiscard]] auto waitForWrite(std::chrono::steady_clock::time_point deadline) -> bool;
+  [[nodiscard]] auto load(const std::uint64_t& pos) const -> std::uint64_t;
+  [[nodiscard]] auto overwritePos() const -> std::uint64_t;
+  [[nodiscard]] auto readHeader(std::uint64_t pos) const -> RecordHeader;
+  [[nodiscard]] auto dropped() -> Status;
+  std::unique_ptr<Impl> impl_;
+  VarConfig config_;
+  std::span<const std::byte> metadata_;
+  std::span<const std::byte> ring_;
+  Counters* counters_{};
+  std::uint64_t read_pos_{};
+  std::uint64_t sequence_{};
+};
+
+//-------------------------------------------------------------------------------------------------
+inline auto VarWriter::maxRecordLength() const -> std::size_t {
+  static constexpr auto ALIGN = VarConfig::RECORD_ALIGNMENT;
+  return ((config_.capacity / 2U) & ~(ALIGN - 1U)) - ALIGN;
+}
+
+//-------------------------------------------------------------------------------------------------
+template <typename F>
+  requires std::is_invocable_r_v<std::size_t, F, std::span<std::byte>>
+auto VarWriter::visit(std::size_t max_length, F&& fn) -> bool {
+  static constexpr auto ALIGN = VarConfig::RECORD_ALIGNMENT;
+  if (max_length > maxRecordLength()) {
+    return false;
+  }
+  const auto capacity = config_.capacity;
+  const auto max_record_size = detail::varRecordSize(max_length);
+  const auto write_pos = counters_->write_pos;  // only this writer modifies it
+  const auto offset = write_pos % capacity;
+  const auto remaining = capacity - offset;
+  const auto needs_padding = (remaining < max_record_size);
+  const auto record_pos = needs_padding ? (write_pos + remaining) : write_pos;
+
+  // Announce the bytes about to be overwritten before touching them, so that readers can detect
+  // that their data was clobbered even though write_pos has not moved yet
+  std::atomic_ref<std::uint64_t>{ counters_->reserve_pos }.store(record_pos + max_record_size,
+                                                                 std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  if (needs_padding) {
+    const auto padding = RecordHeader{ .sequence = sequence_, .length = RecordHeader::PADDING };
+    std::memcpy(ring_.subspan(offset).data(), &padding, sizeof(padding));
+  }
+  const auto record_offset = record_pos % capacity;
+  const auto length = std::invoke(std::forward<F>(fn),
+                                  ring_.subspan(record_offset + ALIGN, max_length));
+  if ((length == 0U) or (length > max_length)) {
+    return false;
+  }
+  const auto header = RecordHeader{ .sequence = sequence_, .length = length };
+  std::memcpy(ring_.subspan(record_offset).data(), &header, sizeof(header));
+  sequence_++;
+
+  // Publish write_pos before latest_pos so that a reader that sees latest_pos also sees the record
+  // as published. seq_cst orders the publish before the waiter check below, so that a reader
+  // registering itself as a waiter concurrently either observes the new record or gets woken up.
+  const auto record_size = detail::varRecordSize(length);
+  std::atomic_ref<std::uint64_t>{ counters_->write_pos }.store(record_pos + record_size,
+                                                               std::memory_order_seq_cst);
+  std::atomic_ref<std::uint64_t>{ counters_->latest_pos }.store(record_pos,
+                                                                std::memory_order_release);
+  if (std::atomic_ref<std::uint32_t>{ counters_->waiters }.load(std::memory_order_seq_cst) != 0U) {
+    notify();
+  }
+  return true;
+}
+
+//-------------------------------------------------------------------------------------------------
+template <typename F>
+  requires std::is_invocable_r_v<bool, F, std::span<const std::byte>>
+[[nodiscard]] auto VarReader::visit(F&& fn, Policy policy) -> Status {
+  static constexpr auto ALIGN = VarConfig::RECORD_ALIGNMENT;
+  const auto capacity = config_.capacity;
+
+  // latest_pos is loaded before write_pos, so it always refers to a published record
+  if (policy == Policy::Latest) {
+    const auto latest_pos = load(counters_->latest_pos);
+    read_pos_ = std::max(read_pos_, latest_pos);
+  }
+  const auto write_pos = load(counters_->write_pos);
+
+  // To read a valid record, all its bytes must be within the last 'capacity' bytes written
+  const auto read_lag = write_pos - read_pos_;
+  if ((read_lag == 0UL) or (read_lag > capacity)) {
+    read_pos_ = write_pos;
+    return (read_lag == 0UL) ? Status::Empty : Status::Dropped;
+  }
+
+  // skip padding at the end of the ring
+  auto header = readHeader(read_pos_);
+  if (header.length == RecordHeader::PADDING) {
+    if ((overwritePos() - read_pos_) > capacity) {
+      return dropped();
+    }
+    read_pos_ += capacity - (read_pos_ % capacity);
+    header = readHeader(read_pos_);
+  }
+
+  // a header torn by the writer lapping us can hold any length; reject it before use
+  const auto offset = read_pos_ % capacity;
+  if (header.length > (capacity - offset - ALIGN)) {
+    return dropped();
+  }
+
+  // call user function
+  if (not std::invoke(std::forward<F>(fn), ring_.subspan(offset + ALIGN, header.length))) {
+    return Status::Canceled;
+  }
+
+  // if writer lapped reader while calling user function, invalidate the read
+  if ((overwritePos() - read_pos_) > capacity) {
+    return dropped();
+  }
+  read_pos_ += detail::varRecordSize(header.length);
+  sequence_ = header.sequence;
+  return Status::Ok;
+}
+
+//-------------------------------------------------------------------------------------------------
+template <typename F>
+  requires std::is_invocable_r_v<bool, F, std::span<const std::byte>>
+[[nodiscard]] auto VarReader::waitVisit(F&& fn, std::chrono::milliseconds timeout, Policy policy)
+    -> Status {
+  const auto deadline = std::chrono::steady_clock::now() + timeout;
+  while (not waitForWrite(deadline)) {
+    if (std::chrono::steady_clock::now() >= deadline) {
+      return Status::Empty;
+    }
+  }
+  return visit(std::forward<F>(fn), policy);
+}
+
+//-------------------------------------------------------------------------------------------------
+inline auto VarReader::load(const std::uint64_t& pos) const -> std::uint64_t {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+  return std::atomic_ref<std::uint64_t>{ const_cast<std::uint64_t&>(pos) }.load(
+      std::memory_order_acquire);
+}
+
+//-------------------------------------------------------------------------------------------------
+inline auto VarReader::overwritePos() const -> std::uint64_t {
+  // Called after reading record data. Returns an upper bound on the bytes the writer has started
+  // to overwrite, including a write that may still be in progress
+  std::atomic_thread_fence(std::memory_order_acquire);
+  const auto write_pos =
+      std::atomic_ref<std::uint64_t>{ counters_->write_pos }.load(std::memory_order_relaxed);
+  const auto reserve_pos =
+      std::atomic_ref<std::uint64_t>{ counters_->reserve_pos }.load(std::memory_order_relaxed);
+  return std::max(write_pos, reserve_pos);
+}
+
+//-------------------------------------------------------------------------------------------------
+inline auto VarReader::readHeader(std::uint64_t pos) const -> RecordHeader {
+  auto header = RecordHeader{};
+  std::memcpy(&header, ring_.subspan(pos % config_.capacity).data(), sizeof(header));
+  return header;
+}
+
+//-------------------------------------------------------------------------------------------------
+inline auto VarReader::dropped() -> Status {
+  read_pos_ = load(counters_->write_pos);
+  return Status::Dropped;
+}
+
+}  // namespace grape::spmcq
@@ -14,42 +14,61 @@
 
 #include "grape/exception.h"
 #include "grape/shared_memory.h"
+#include "spmcq_common.h"
 
 namespace {
-//-------------------------------------------------------------------------------------------------
-auto shmName(std::string_view name) -> std::string {
-  return name.starts_with('/') ? std::string(name) : std::format("/{}", name);
-}
 
-//-------------------------------------------------------------------------------------------------
-// Aligns 'n' up to the nearest multiple of 'align'
-[[nodiscard]] constexpr auto alignUp(std::size_t n, std::size_t align) -> std::size_t {
-  return (n + align - 1U) & ~(align - 1U);
-}
+using grape::spmcq::detail::alignUp;
+using grape::spmcq::detail::futexWait;
+using grape::spmcq::detail::futexWake;
+using grape::spmcq::detail::shmName;
 
 //=================================================================================================
 // Memory layout of the shared memory region:
-// [Control | Metadata (optional) | padding (aligns Frames with cache-line) | Frame 0 ... Frame N-1]
+// [Control | Metadata (optional) | padding (cache-line) | Headers (optional) | Frame 0 ... N-1]
 //
 // control_offset = 0
 // metadata_offset = sizeof(Control) [known at compile time]
-// frames_offset = alignUp(metadata_offset + metadata_length, cache_line_size)
+// headers_offset = alignUp(metadata_offset + metadata_length, cache_line_size)
+// frames_offset = headers_offset + (versioned ? num_frames * sizeof(FrameHeader) : 0)
 //=================================================================================================
 
 //=================================================================================================
 // Control region. Describes configuration and state of ring buffer
+// The first two fields stay at the same offsets across layout versions, so that a reader can tell
+// a region written with a different layout from one that is not ready yet.
 struct Control {
+  std::uint64_t magic{};
+  std::uint32_t layout_version{};
+  std::uint32_t waiters{};  //!< Number of readers blocked waiting on write_count
   std::uint64_t write_count{};
+  std::uint64_t reserve_count{};  //!< End of frames being overwritten by an in-progress batch
   grape::spmcq::Config config;
   std::uint64_t metadata_length{};
+  std::uint64_t headers_offset{};
   std::uint64_t frames_offset{};
-  std::uint64_t magic{};
   static constexpr auto MAGIC = 0x00465542434D5053U;  //!< "SPMCBUF\0";
+  static constexpr auto LAYOUT_VERSION = 2U;           //!< Bump on any change to this region
 };
 
-static_assert(offsetof(Control, write_count) == 0U);  // ensure alignment for atomic_ref
+static_assert(offsetof(Control, magic) == 0U);
+static_assert(offsetof(Control, layout_version) == sizeof(std::uint64_t));
+static_assert(offsetof(Control, write_count) % alignof(std::uint64_t) == 0U);  // for atomic_ref
+static_assert(offsetof(Control, reserve_count) % alignof(std::uint64_t) == 0U);
+static_assert(offsetof(Control, waiters) % alignof(std::uint32_t) == 0U);
 static_assert(std::is_trivially_copyable_v<Control>);
+static_assert(sizeof(grape::spmcq::detail::FrameHeader) == 64U);
 static_assert(std::atomic_ref<std::uint64_t>::is_always_lock_free);
+static_assert(std::atomic_ref<std::uint32_t>::is_always_lock_free);
+
+//-------------------------------------------------------------------------------------------------
+// View a cache-line aligned region of shared memory as a table of frame headers
+auto asHeaders(std::span<std::byte> region) -> std::span<grape::spmcq::detail::FrameHeader> {
+  using FrameHeader = grape::spmcq::detail::FrameHeader;
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  auto* const first = reinterpret_cast<FrameHeader*>(region.data());
+  return { first, region.size_bytes() / sizeof(FrameHeader) };
+}
 
 }  // namespace
 
@@ -76,9 +95,12 @@ auto Writer::create(std::string_view name, const Config& config,
   const auto control_len = sizeof(Control);
   const auto metadata_len = metadata.size_bytes();
   const auto preamble_len = control_len + metadata_len;
-  const auto frames_offset = alignUp(preamble_len, std::hardware_destructive_interference_size);
+  const auto headers_offset = alignUp(preamble_len, std::hardware_destructive_interference_size);
+  const auto headers_len = config.versioned ? config.num_frames * sizeof(detail::FrameHeader) : 0U;
+  const auto frames_offset = headers_offset + headers_len;
   const auto shm_len = frames_offset + data_size;
-  auto maybe_shm = SharedMemory::create(shm_name, shm_len, SharedMemory::Access::ReadWrite);
+  auto maybe_shm = SharedMemory::create(shm_name, shm_len, SharedMemory::Access::ReadWrite,
+                                         config.memory);
   if (not maybe_shm) {
     if (SharedMemory::exists(shm_name)) {
       return std::unexpected{ Error{ std::format("'{}' already exists", shm_name) } };
@@ -94,22 +116,33 @@ auto Writer::create(std::string_view name, const Config& config,
   auto* ctrl = reinterpret_cast<Control*>(shm.data());
 
   ctrl->magic = 0U;  // Will be set when the region is ready for readers
+  ctrl->layout_version = Control::LAYOUT_VERSION;
   ctrl->config = config;
   ctrl->write_count = 0U;
+  ctrl->reserve_count = 0U;
+  ctrl->waiters = 0U;
   ctrl->metadata_length = metadata_len;
+  ctrl->headers_offset = headers_offset;
   ctrl->frames_offset = frames_offset;
 
   // copy metadata into the buffer immediately after the control block
   std::ranges::copy(metadata, shm.subspan(control_len).begin());
 
+  // all frames start out at version 0 (written, never read)
+  const auto headers = asHeaders(shm.subspan(headers_offset, headers_len));
+  std::ranges::fill(headers, detail::FrameHeader{});
+
   // Mark as ready for readers
   std::atomic_ref<std::uint64_t>(ctrl->magic).store(Control::MAGIC, std::memory_order_release);
 
   // cache pointers to hot-path data
   auto* const write_count_ptr = &ctrl->write_count;
-  const auto frames = shm.subspan(frames_offset);
+  auto* const reserve_count_ptr = &ctrl->reserve_count;
+  auto* const waiters_ptr = &ctrl->waiters;
+  const auto frames = shm.subspan(frames_offset, data_size);
 
-  return Writer{ std::string{ name }, std::move(impl), config, frames, write_count_ptr };
+  return Writer{ std::string{ name }, std::move(impl), config,           frames, headers,
+                 write_count_ptr,     reserve_count_ptr, waiters_ptr };
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -126,12 +159,22 @@ Writer::~Writer() {
 
 //-------------------------------------------------------------------------------------------------
 Writer::Writer(std::string name, std::unique_ptr<Impl> impl, const Config& config,
-               std::span<std::byte> frames, std::uint64_t* write_count_ptr)
+               std::span<std::byte> frames, std::span<detail::FrameHeader> headers,
+               std::uint64_t* write_count_ptr, std::uint64_t* reserve_count_ptr,
+               std::uint32_t* waiters_ptr)
   : name_(std::move(name))
   , impl_{ std::move(impl) }
   , config_{ config }
   , frames_{ frames }
-  , write_count_ptr_{ write_count_ptr } {
+  , headers_{ headers }
+  , write_count_ptr_{ write_count_ptr }
+  , reserve_count_ptr_{ reserve_count_ptr }
+  , waiters_ptr_{ waiters_ptr } {
+}
+
+//-------------------------------------------------------------------------------------------------
+void Writer::notify() {
+  futexWake(write_count_ptr_);
 }
 
 //=================================================================================================
@@ -142,7 +185,7 @@ struct Reader::Impl : public SharedMemory {
 
 //-------------------------------------------------------------------------------------------------
 auto Reader::connect(std::string_view name) -> std::expected<Reader, Error> {
-  auto maybe_shm = SharedMemory::open(shmName(name), SharedMemory::Access::ReadOnly);
+  auto maybe_shm = SharedMemory::open(shmName(name), SharedMemory::Access::ReadWrite);
   if (not maybe_shm) {
     return std::unexpected{ maybe_shm.error() };
   }
@@ -161,6 +204,11 @@ auto Reader::connect(std::string_view name) -> std::expected<Reader, Error> {
   if (magic != Control::MAGIC) {
     return std::unexpected{ Error{ std::format("'{}' is not ready", name) } };
   }
+  if (ctrl->layout_version != Control::LAYOUT_VERSION) {
+    return std::unexpected{ Error{
+        std::format("'{}' has incompatible layout version {} (expected {})", name,
+                    ctrl->layout_version, Control::LAYOUT_VERSION) } };
+  }
   const auto& config = ctrl->config;
   const auto frames_len = config.frame_length * config.num_frames;
   const auto expected_size = ctrl->frames_offset + frames_len;
@@ -170,15 +218,23 @@ auto Reader::connect(std::string_view name) -> std::expected<Reader, Error> {
   }
 
   const auto control_len = sizeof(Control);
-  if (control_len + ctrl->metadata_length > ctrl->frames_offset) {
+  if (control_len + ctrl->metadata_length > ctrl->headers_offset) {
     return std::unexpected{ Error{ std::format("'{}' has invalid metadata length", name) } };
   }
+  const auto headers_len = config.versioned ? config.num_frames * sizeof(detail::FrameHeader) : 0U;
+  if (ctrl->headers_offset + headers_len != ctrl->frames_offset) {
+    return std::unexpected{ Error{ std::format("'{}' has invalid frame headers", name) } };
+  }
+  const auto headers = asHeaders(shm.subspan(ctrl->headers_offset, headers_len));
   const auto metadata = shm.subspan(control_len, ctrl->metadata_length);
 
-  auto* const write_count_ptr = &ctrl->write_count;
+  const auto* const write_count_ptr = &ctrl->write_count;
+  const auto* const reserve_count_ptr = &ctrl->reserve_count;
+  auto* const waiters_ptr = &ctrl->waiters;
   const auto frames = shm.subspan(ctrl->frames_offset, frames_len);
 
-  return Reader{ std::move(impl), config, metadata, frames, write_count_ptr };
+  return Reader{ std::move(impl), config,          metadata,          frames, headers,
+                 write_count_ptr, reserve_count_ptr, waiters_ptr };
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -195,12 +251,44 @@ auto Reader::metadata() const -> std::span<const std::byte> {
 Reader::Reader(std::unique_ptr<Impl> impl, const Config& config,
                // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
                std::span<const std::byte> metadata, std::span<const std::byte> frames,
-               const std::uint64_t* write_count_ptr)
+               std::span<const detail::FrameHeader> headers,
+               const std::uint64_t* write_count_ptr, const std::uint64_t* reserve_count_ptr,
+               std::uint32_t* waiters_ptr)
   : impl_{ std::move(impl) }
   , config_{ config }
   , metadata_{ metadata }
   , frames_{ frames }
-  , write_count_ptr_{ write_count_ptr } {
+  , headers_{ headers }
+  , write_count_ptr_{ write_count_ptr }
+  , reserve_count_ptr_{ reserve_count_ptr }
+  , waiters_ptr_{ waiters_ptr } {
+}
+
+//-------------------------------------------------------------------------------------------------
+auto Reader::waitForWrite(std::chrono::steady_clock::time_point deadline) -> bool {
+  // NOLINTBEGIN(cppcoreguidelines-pro-type-const-cast)
+  const auto wc_ref =
+      std::atomic_ref<std::uint64_t>{ *const_cast<std::uint64_t*>(write_count_ptr_) };
+  // NOLINTEND(cppcoreguidelines-pro-type-const-cast)
+
+  if (wc_ref.load(std::memory_order_acquire) != read_count_) {
+    return true;  // unread frames available; no need to block
+  }
+
+  // Register as waiter before re-checking the write counter. Pairs with the seq_cst increment and
+  // waiter check in Writer::visit() so that either we see the new frame or the writer wakes us.
+  const auto waiters_ref = std::atomic_ref<std::uint32_t>{ *waiters_ptr_ };
+  waiters_ref.fetch_add(1U, std::memory_order_seq_cst);
+  const auto write_count = wc_ref.load(std::memory_order_seq_cst);
+  if (write_count == read_count_) {
+    const auto remaining = deadline - std::chrono::steady_clock::now();
+    if (remaining > std::chrono::steady_clock::duration::zero()) {
+      futexWait(write_count_ptr_, write_count,
+                std::chrono::duration_cast<std::chrono::nanoseconds>(remaining));
+    }
+  }
+  waiters_ref.fetch_sub(1U, std::memory_order_seq_cst);
+  return (wc_ref.load(std::memory_order_acquire) != read_count_);
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -0,0 +1,71 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#pragma once
+
+#include <bit>
+#include <cerrno>
+#include <chrono>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <format>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <tuple>  // for ignore
+
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "grape/exception.h"
+
+// Facilities shared by the fixed-frame and variable-length ring buffer implementations
+namespace grape::spmcq::detail {
+
+//-------------------------------------------------------------------------------------------------
+inline auto shmName(std::string_view name) -> std::string {
+  return name.starts_with('/') ? std::string(name) : std::format("/{}", name);
+}
+
+//-------------------------------------------------------------------------------------------------
+// Aligns 'n' up to the nearest multiple of 'align'
+[[nodiscard]] constexpr auto alignUp(std::size_t n, std::size_t align) -> std::size_t {
+  return (n + align - 1U) & ~(align - 1U);
+}
+
+// Readers block on a futex over the lower 32 bits of the 64-bit write counter. Implicit
+// assumptions:
+// - A waiting reader is not lapped by exactly 2^32 counts between checking and sleeping
+// - CPU is little-endian (X86_64, Aarch64)
+static_assert(std::endian::native == std::endian::little);
+
+//-------------------------------------------------------------------------------------------------
+// Wakes up all readers blocked on the write counter
+inline void futexWake(std::uint64_t* write_count_ptr) {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+  const auto result = syscall(SYS_futex, write_count_ptr, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+  if (result == -1) {
+    const auto err = std::error_code(errno, std::system_category());
+    panic<Exception>("(futex_wake) " + err.message());  // EINVAL improbable
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+// Blocks until the lower 32 bits of write counter differ from 'expected' or timeout expires
+inline void futexWait(const std::uint64_t* write_count_ptr, std::uint64_t expected,
+                      std::chrono::nanoseconds timeout) {
+  const auto sec = std::chrono::duration_cast<std::chrono::seconds>(timeout);
+  const auto nsec = std::chrono::duration_cast<std::chrono::nanoseconds>(timeout - sec);
+  const auto ts = timespec{ .tv_sec = sec.count(), .tv_nsec = nsec.count() };
+  const auto fut_val = static_cast<std::uint32_t>(expected);
+  // Errors are deliberately ignored: EAGAIN (value already changed), ETIMEDOUT and EINTR are all
+  // handled by the caller re-checking the write counter and the deadline.
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-vararg)
+  std::ignore = syscall(SYS_futex, write_count_ptr, FUTEX_WAIT, fut_val, &ts, nullptr, 0);
+}
+
+}  // namespace grape::spmcq::detail
@@ -0,0 +1,243 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#include "grape/realtime/spmcq_var.h"
+
+#include <algorithm>  // for __copy, copy
+#include <atomic>
+#include <format>
+#include <memory>
+#include <new>
+#include <tuple>  // for __ignore_type, ignore
+#include <type_traits>
+
+#include "grape/exception.h"
+#include "grape/shared_memory.h"
+#include "spmcq_common.h"
+
+namespace {
+
+//=================================================================================================
+// Memory layout of the shared memory region:
+// [VarControl | Metadata (optional) | padding (cache-line) | Ring (capacity bytes)]
+//
+// Ring contents:
+// [Header | Payload | pad to RECORD_ALIGNMENT] [Header | Payload | pad] ... [Header (PADDING)]
+//=================================================================================================
+
+//=================================================================================================
+// Control region. Describes configuration and state of ring buffer
+// The first two fields stay at the same offsets across layout versions, so that a reader can tell
+// a region written with a different layout from one that is not ready yet.
+struct VarControl {
+  std::uint64_t magic{};
+  std::uint32_t layout_version{};
+  grape::spmcq::detail::VarCounters counters;
+  grape::spmcq::VarConfig config;
+  std::uint64_t metadata_length{};
+  std::uint64_t ring_offset{};
+  static constexpr auto MAGIC = 0x00524156434D5053U;  //!< "SPMCVAR\0";
+  static constexpr auto LAYOUT_VERSION = 2U;           //!< Bump on any change to this region
+};
+
+static_assert(offsetof(VarControl, magic) == 0U);
+static_assert(offsetof(VarControl, layout_version) == sizeof(std::uint64_t));
+static_assert(offsetof(VarControl, counters) % alignof(std::uint64_t) == 0U);  // for atomic_ref
+static_assert(offsetof(grape::spmcq::detail::VarCounters, write_pos) == 0U);  // futex address
+static_assert(std::is_trivially_copyable_v<VarControl>);
+static_assert(std::atomic_ref<std::uint64_t>::is_always_lock_free);
+static_assert(std::atomic_ref<std::uint32_t>::is_always_lock_free);
+
+}  // namespace
+
+namespace grape::spmcq {
+
+//=================================================================================================
+struct VarWriter::Impl : public SharedMemory {
+  explicit Impl(SharedMemory shm) : SharedMemory(std::move(shm)) {
+  }
+};
+
+//-------------------------------------------------------------------------------------------------
+auto VarWriter::create(std::string_view name, const VarConfig& config,
+                       std::span<const std::byte> metadata) -> std::expected<VarWriter, Error> {
+  if ((config.capacity < VarConfig::MIN_CAPACITY) or
+      (config.capacity % VarConfig::RECORD_ALIGNMENT != 0U)) {
+    return std::unexpected{ Error{ "Invalid configuration (capacity)" } };
+  }
+
+  const auto shm_name = detail::shmName(name);
+  const auto control_len = sizeof(VarControl);
+  const auto metadata_len = metadata.size_bytes();
+  const auto ring_offset =
+      detail::alignUp(control_len + metadata_len, std::hardware_destructive_interference_size);
+  const auto shm_len = ring_offset + config.capacity;
+  auto maybe_shm = SharedMemory::create(shm_name, shm_len, SharedMemory::Access::ReadWrite,
+                                         config.memory);
+  if (not maybe_shm) {
+    if (SharedMemory::exists(shm_name)) {
+      return std::unexpected{ Error{ std::format("'{}' already exists", shm_name) } };
+    }
+    return std::unexpected{ maybe_shm.error() };
+  }
+
+  // initialise the shared memory region
+  auto impl = std::make_unique<VarWriter::Impl>(std::move(maybe_shm.value()));
+  auto shm = impl->data();
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  auto* ctrl = reinterpret_cast<VarControl*>(shm.data());
+
+  ctrl->magic = 0U;  // Will be set when the region is ready for readers
+  ctrl->layout_version = VarControl::LAYOUT_VERSION;
+  ctrl->counters = {};
+  ctrl->config = config;
+  ctrl->metadata_length = metadata_len;
+  ctrl->ring_offset = ring_offset;
+
+  // copy metadata into the buffer immediately after the control block
+  std::ranges::copy(metadata, shm.subspan(control_len).begin());
+
+  // Mark as ready for readers
+  std::atomic_ref<std::uint64_t>(ctrl->magic).store(VarControl::MAGIC, std::memory_order_release);
+
+  const auto ring = shm.subspan(ring_offset, config.capacity);
+  return VarWriter{ std::string{ name }, std::move(impl), config, ring, &ctrl->counters };
+}
+
+//-------------------------------------------------------------------------------------------------
+VarWriter::~VarWriter() {
+  if (impl_ == nullptr) {
+    return;  // moved-from state, nothing to clean up
+  }
+  try {
+    std::ignore = SharedMemory::remove(detail::shmName(name_));
+  } catch (...) {
+    grape::Exception::print();
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+VarWriter::VarWriter(std::string name, std::unique_ptr<Impl> impl, const VarConfig& config,
+                     std::span<std::byte> ring, Counters* counters)
+  : name_(std::move(name))
+  , impl_{ std::move(impl) }
+  , config_{ config }
+  , ring_{ ring }
+  , counters_{ counters } {
+}
+
+//-------------------------------------------------------------------------------------------------
+void VarWriter::notify() {
+  detail::futexWake(&counters_->write_pos);
+}
+
+//=================================================================================================
+struct VarReader::Impl : public SharedMemory {
+  explicit Impl(SharedMemory shm) : SharedMemory(std::move(shm)) {
+  }
+};
+
+//-------------------------------------------------------------------------------------------------
+auto VarReader::connect(std::string_view name) -> std::expected<VarReader, Error> {
+  auto maybe_shm = SharedMemory::open(detail::shmName(name), SharedMemory::Access::ReadWrite);
+  if (not maybe_shm) {
+    return std::unexpected{ maybe_shm.error() };
+  }
+
+  if (maybe_shm->data().size_bytes() < sizeof(VarControl)) {
+    return std::unexpected{ Error{ std::format("'{}' has unexpected size (too small)", name) } };
+  }
+
+  auto impl = std::make_unique<VarReader::Impl>(std::move(maybe_shm.value()));
+  auto shm = impl->data();
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  auto* ctrl = reinterpret_cast<VarControl*>(shm.data());
+
+  const auto magic = std::atomic_ref<std::uint64_t>(ctrl->magic).load(std::memory_order_acquire);
+  if (magic != VarControl::MAGIC) {
+    return std::unexpected{ Error{ std::format("'{}' is not ready", name) } };
+  }
+  if (ctrl->layout_version != VarControl::LAYOUT_VERSION) {
+    return std::unexpected{ Error{
+        std::format("'{}' has incompatible layout version {} (expected {})", name,
+                    ctrl->layout_version, VarControl::LAYOUT_VERSION) } };
+  }
+  const auto& config = ctrl->config;
+  const auto expected_size = ctrl->ring_offset + config.capacity;
+  if (shm.size_bytes() < expected_size) {
+    return std::unexpected{ Error{
+        std::format("'{}' has unexpected data size (too small)", name) } };
+  }
+
+  const auto control_len = sizeof(VarControl);
+  if (control_len + ctrl->metadata_length > ctrl->ring_offset) {
+    return std::unexpected{ Error{ std::format("'{}' has invalid metadata length", name) } };
+  }
+  const auto metadata = shm.subspan(control_len, ctrl->metadata_length);
+  const auto ring = shm.subspan(ctrl->ring_offset, config.capacity);
+
+  return VarReader{ std::move(impl), config, metadata, ring, &ctrl->counters };
+}
+
+//-------------------------------------------------------------------------------------------------
+auto VarReader::config() const -> VarConfig {
+  return config_;
+}
+
+//-------------------------------------------------------------------------------------------------
+auto VarReader::metadata() const -> std::span<const std::byte> {
+  return metadata_;
+}
+
+//-------------------------------------------------------------------------------------------------
+auto VarReader::sequence() const -> std::uint64_t {
+  return sequence_;
+}
+
+//-------------------------------------------------------------------------------------------------
+VarReader::VarReader(std::unique_ptr<Impl> impl, const VarConfig& config,
+                     // NOLINTNEXTLINE(bugprone-easily-swappable-parameters)
+                     std::span<const std::byte> metadata, std::span<const std::byte> ring,
+                     Counters* counters)
+  : impl_{ std::move(impl) }
+  , config_{ config }
+  , metadata_{ metadata }
+  , ring_{ ring }
+  , counters_{ counters } {
+}
+
+//-------------------------------------------------------------------------------------------------
+VarReader::~VarReader() = default;
+
+//-------------------------------------------------------------------------------------------------
+auto VarReader::exists(std::string_view name) -> bool {
+  return SharedMemory::exists(detail::shmName(name));
+}
+
+//-------------------------------------------------------------------------------------------------
+auto VarReader::waitForWrite(std::chrono::steady_clock::time_point deadline) -> bool {
+  const auto wp_ref = std::atomic_ref<std::uint64_t>{ counters_->write_pos };
+  if (wp_ref.load(std::memory_order_acquire) != read_pos_) {
+    return true;  // unread records available; no need to block
+  }
+
+  // Register as waiter before re-checking the write position. Pairs with the seq_cst publish and
+  // waiter check in VarWriter::visit() so that either we see the new record or the writer wakes us
+  const auto waiters_ref = std::atomic_ref<std::uint32_t>{ counters_->waiters };
+  waiters_ref.fetch_add(1U, std::memory_order_seq_cst);
+  const auto write_pos = wp_ref.load(std::memory_order_seq_cst);
+  if (write_pos == read_pos_) {
+    const auto remaining = deadline - std::chrono::steady_clock::now();
+    if (remaining > std::chrono::steady_clock::duration::zero()) {
+      detail::futexWait(&counters_->write_pos, write_pos,
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(remaining));
+    }
+  }
+  waiters_ref.fetch_sub(1U, std::memory_order_seq_cst);
+  return (wp_ref.load(std::memory_order_acquire) != read_pos_);
+}
+
+}  // namespace grape::spmcq
@@ -3,12 +3,16 @@
 //=================================================================================================
 
 #include <atomic>
+#include <chrono>
 #include <cstring>
 #include <format>
 #include <thread>
+#include <tuple>
+#include <vector>
 
 #include "catch2/catch_test_macros.hpp"
 #include "grape/realtime/spmcq.h"
+#include "grape/shared_memory.h"
 #include "grape/wall_clock.h"
 
 namespace {
@@ -186,6 +190,26 @@ TEST_CASE("Connect to non-existent buffer returns error", "[spmcq]") {
   REQUIRE_FALSE(Reader::connect(UNKNOWN));
 }
 
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Connect to buffer with a different layout version returns error", "[spmcq]") {
+  const auto name = uniqueName();
+  auto maybe_writer = Writer::create(name, Config{ .frame_length = 8U, .num_frames = 4U });
+  REQUIRE(maybe_writer);
+  REQUIRE(Reader::connect(name));
+
+  // The layout version follows the 8-byte magic at the start of the region
+  auto shm = grape::SharedMemory::open("/" + name, grape::SharedMemory::Access::ReadWrite);
+  REQUIRE(shm);
+  auto version = std::uint32_t{};
+  std::memcpy(&version, shm->data().subspan(sizeof(std::uint64_t)).data(), sizeof(version));
+  version += 1U;
+  std::memcpy(shm->data().subspan(sizeof(std::uint64_t)).data(), &version, sizeof(version));
+
+  const auto maybe_reader = Reader::connect(name);
+  REQUIRE_FALSE(maybe_reader);
+  REQUIRE(maybe_reader.error().message().contains("layout version"));
+}
+
 //-------------------------------------------------------------------------------------------------
 TEST_CASE("exists() reflects writer lifecycle", "[spmcq]") {
   const auto name = uniqueName();
@@ -377,6 +401,322 @@ TEST_CASE("Non-empty metadata is accessible to reader", "[spmcq]") {
   REQUIRE(meta.size() == META.size());
   REQUIRE(std::equal(meta.begin(), meta.end(), META.begin()));
 }
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("waitVisit times out when nothing is written", "[spmcq]") {
+  const auto name = uniqueName();
+  auto maybe_writer = Writer::create(name, Config{ .frame_length = 8U, .num_frames = 4U });
+  REQUIRE(maybe_writer);
+  auto maybe_reader = Reader::connect(name);
+  REQUIRE(maybe_reader);
+  auto& reader = maybe_reader.value();
+
+  static constexpr auto TIMEOUT = std::chrono::milliseconds(20);
+  const auto start = std::chrono::steady_clock::now();
+  const auto status = reader.waitVisit([](std::span<const std::byte>) { return true; }, TIMEOUT);
+  REQUIRE(status == Reader::Status::Empty);
+  REQUIRE(std::chrono::steady_clock::now() - start >= TIMEOUT);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("waitVisit returns unread frame without blocking", "[spmcq]") {
+  const auto name = uniqueName();
+  auto maybe_writer = Writer::create(name, Config{ .frame_length = 8U, .num_frames = 4U });
+  REQUIRE(maybe_writer);
+  auto& writer = maybe_writer.value();
+  auto maybe_reader = Reader::connect(name);
+  REQUIRE(maybe_reader);
+  auto& reader = maybe_reader.value();
+
+  static constexpr auto EXPECTED = std::uint64_t{ 42 };
+  writeValue(writer, EXPECTED);
+
+  std::uint64_t value{};
+  const auto status = reader.waitVisit(
+      [&value](std::span<const std::byte> frame) {
+        std::memcpy(&value, frame.data(), sizeof(value));
+        return true;
+      },
+      std::chrono::milliseconds(0));
+  REQUIRE(status == Reader::Status::Ok);
+  REQUIRE(value == EXPECTED);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("waitVisit with policy Latest blocks until a newer frame is written", "[spmcq]") {
+  const auto name = uniqueName();
+  auto maybe_writer = Writer::create(name, Config{ .frame_length = 8U, .num_frames = 4U });
+  REQUIRE(maybe_writer);
+  auto& writer = maybe_writer.value();
+  auto maybe_reader = Reader::connect(name);
+  REQUIRE(maybe_reader);
+  auto& reader = maybe_reader.value();
+
+  writeValue(writer, 1U);
+  const auto read_fn = [](std::span<const std::byte>) { return true; };
+  static constexpr auto TIMEOUT = std::chrono::milliseconds(10);
+  REQUIRE(reader.waitVisit(read_fn, TIMEOUT, Reader::Policy::Latest) == Reader::Status::Ok);
+  REQUIRE(reader.waitVisit(read_fn, TIMEOUT, Reader::Policy::Latest) == Reader::Status::Empty);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Blocked reader is woken up by writer", "[spmcq]") {
+  static constexpr auto NUM_WRITES = 100UZ;
+  const auto name = uniqueName();
+  auto maybe_writer =
+      Writer::create(name, Config{ .frame_length = 8U, .num_frames = NUM_WRITES + 1UZ });
+  REQUIRE(maybe_writer);
+  auto maybe_reader = Reader::connect(name);
+  REQUIRE(maybe_reader);
+  auto& writer = maybe_writer.value();
+  auto& reader = maybe_reader.value();
+
+  std::thread producer([&writer]() {
+    static constexpr auto WRITE_PERIOD = std::chrono::microseconds(100);
+    for (std::uint64_t i = 0; i < NUM_WRITES; ++i) {
+      std::this_thread::sleep_for(WRITE_PERIOD);
+      writeValue(writer, i);
+    }
+  });
+
+  static constexpr auto TIMEOUT = std::chrono::milliseconds(1000);
+  auto reads = 0UZ;
+  auto expected = std::uint64_t{ 0 };
+  auto in_order = true;
+  while (reads < NUM_WRITES) {
+    std::uint64_t value{};
+    const auto status = reader.waitVisit(
+        [&value](std::span<const std::byte> frame) {
+          std::memcpy(&value, frame.data(), sizeof(value));
+          return true;
+        },
+        TIMEOUT);
+    if (status != Reader::Status::Ok) {
+      break;
+    }
+    in_order = in_order and (value == expected++);
+    ++reads;
+  }
+  producer.join();
+  REQUIRE(reads == NUM_WRITES);
+  REQUIRE(in_order);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("visitBatch rejects invalid batch sizes", "[spmcq]") {
+  static constexpr auto CAPACITY = 4UZ;
+  const auto name = uniqueName();
+  auto maybe_writer = Writer::create(name, Config{ .frame_length = 8U, .num_frames = CAPACITY });
+  REQUIRE(maybe_writer);
+  auto& writer = maybe_writer.value();
+
+  const auto write_fn = [](std::span<std::byte>, std::span<std::byte>) { return true; };
+  REQUIRE_FALSE(writer.visitBatch(0U, write_fn));
+  REQUIRE_FALSE(writer.visitBatch(CAPACITY + 1U, write_fn));
+  REQUIRE(writer.visitBatch(CAPACITY, write_fn));
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Batched writes and ranged reads round-trip across ring wrap", "[spmcq]") {
+  static constexpr auto CAPACITY = 8UZ;
+  static constexpr auto BATCH = 5UZ;
+  const auto name = uniqueName();
+  auto maybe_writer = Writer::create(name, Config{ .frame_length = 8U, .num_frames = CAPACITY });
+  REQUIRE(maybe_writer);
+  auto& writer = maybe_writer.value();
+  auto maybe_reader = Reader::connect(name);
+  REQUIRE(maybe_reader);
+  auto& reader = maybe_reader.value();
+
+  auto next_value = std::uint64_t{ 0 };
+  const auto write_fn = [&next_value](std::span<std::byte> head, std::span<std::byte> tail) {
+    for (const auto region : { head, tail }) {
+      for (auto offset = 0UZ; offset < region.size(); offset += sizeof(std::uint64_t)) {
+        std::memcpy(region.subspan(offset).data(), &next_value, sizeof(next_value));
+        ++next_value;
+      }
+    }
+    return true;
+  };
+
+  auto values = std::vector<std::uint64_t>{};
+  const auto read_fn = [&values](std::span<const std::byte> head, std::span<const std::byte> tail) {
+    for (const auto region : { head, tail }) {
+      for (auto offset = 0UZ; offset < region.size(); offset += sizeof(std::uint64_t)) {
+        std::uint64_t value{};
+        std::memcpy(&value, region.subspan(offset).data(), sizeof(value));
+        values.push_back(value);
+      }
+    }
+    return true;
+  };
+
+  // second batch of each round wraps around the end of the ring
+  for (auto round = 0UZ; round < 3UZ; ++round) {
+    values.clear();
+    REQUIRE(writer.visitBatch(BATCH, write_fn));
+    REQUIRE(reader.visitRange(read_fn) == Reader::Status::Ok);
+    REQUIRE(values.size() == BATCH);
+    for (auto i = 0UZ; i < BATCH; ++i) {
+      REQUIRE(values.at(i) == (round * BATCH) + i);
+    }
+  }
+  REQUIRE(reader.visitRange(read_fn) == Reader::Status::Empty);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("visitRange returns Dropped when lapped", "[spmcq]") {
+  static constexpr auto CAPACITY = 4UZ;
+  const auto name = uniqueName();
+  auto maybe_writer = Writer::create(name, Config{ .frame_length = 8U, .num_frames = CAPACITY });
+  REQUIRE(maybe_writer);
+  auto& writer = maybe_writer.value();
+  auto maybe_reader = Reader::connect(name);
+  REQUIRE(maybe_reader);
+  auto& reader = maybe_reader.value();
+
+  const auto write_fn = [](std::span<std::byte>, std::span<std::byte>) { return true; };
+  REQUIRE(writer.visitBatch(CAPACITY, write_fn));
+  REQUIRE(writer.visitBatch(1U, write_fn));
+
+  const auto read_fn = [](std::span<const std::byte>, std::span<const std::byte>) { return true; };
+  REQUIRE(reader.visitRange(read_fn) == Reader::Status::Dropped);
+  REQUIRE(reader.visitRange(read_fn) == Reader::Status::Empty);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Frame overwritten by in-progress batch is reported as Dropped", "[spmcq]") {
+  static constexpr auto CAPACITY = 4UZ;
+  const auto name = uniqueName();
+  auto maybe_writer = Writer::create(name, Config{ .frame_length = 8U, .num_frames = CAPACITY });
+  REQUIRE(maybe_writer);
+  auto& writer = maybe_writer.value();
+  auto maybe_reader = Reader::connect(name);
+  REQUIRE(maybe_reader);
+  auto& reader = maybe_reader.value();
+
+  writeValue(writer, 1U);
+  writeValue(writer, 2U);
+
+  // Reader is inside its callback for frame 0 when the writer begins a batch overwriting it
+  const auto status = reader.visit([&writer](std::span<const std::byte>) {
+    const auto batch_fn = [](std::span<std::byte>, std::span<std::byte>) { return false; };
+    std::ignore = writer.visitBatch(CAPACITY - 1U, batch_fn);
+    return true;
+  });
+  REQUIRE(status == Reader::Status::Dropped);
+}
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Versioned buffer round-trips data across ring wrap", "[spmcq]") {
+  static constexpr auto CAPACITY = 4UZ;
+  const auto name = uniqueName();
+  const auto config = Config{ .frame_length = 8U, .num_frames = CAPACITY, .versioned = true };
+  auto maybe_writer = Writer::create(name, config);
+  REQUIRE(maybe_writer);
+  auto& writer = maybe_writer.value();
+  auto maybe_reader = Reader::connect(name);
+  REQUIRE(maybe_reader);
+  auto& reader = maybe_reader.value();
+  REQUIRE(reader.config().versioned);
+
+  for (auto i = 0UZ; i < 3UZ * CAPACITY; ++i) {
+    writeValue(writer, i);
+    const auto [status, value] = readValue(reader, Reader::Policy::Next);
+    REQUIRE(status == Reader::Status::Ok);
+    REQUIRE(value == i);
+  }
+  REQUIRE(readValue(reader, Reader::Policy::Next).first == Reader::Status::Empty);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Versioned reader can read the oldest frame of a full buffer", "[spmcq]") {
+  static constexpr auto CAPACITY = 4UZ;
+  const auto name = uniqueName();
+  const auto config = Config{ .frame_length = 8U, .num_frames = CAPACITY, .versioned = true };
+  auto maybe_writer = Writer::create(name, config);
+  REQUIRE(maybe_writer);
+  auto& writer = maybe_writer.value();
+  auto maybe_reader = Reader::connect(name);
+  REQUIRE(maybe_reader);
+  auto& reader = maybe_reader.value();
+
+  for (auto i = 0UZ; i < CAPACITY; ++i) {
+    writeValue(writer, i);
+  }
+  for (auto i = 0UZ; i < CAPACITY; ++i) {
+    const auto [status, value] = readValue(reader, Reader::Policy::Next);
+    REQUIRE(status == Reader::Status::Ok);
+    REQUIRE(value == i);
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Write to a different frame during read is only reported as Dropped if unversioned",
+          "[spmcq]") {
+  static constexpr auto CAPACITY = 4UZ;
+  for (const auto versioned : { false, true }) {
+    const auto name = uniqueName();
+    const auto config =
+        Config{ .frame_length = 8U, .num_frames = CAPACITY, .versioned = versioned };
+    auto maybe_writer = Writer::create(name, config);
+    REQUIRE(maybe_writer);
+    auto& writer = maybe_writer.value();
+    auto maybe_reader = Reader::connect(name);
+    REQUIRE(maybe_reader);
+    auto& reader = maybe_reader.value();
+
+    for (auto i = 0UZ; i < CAPACITY - 1U; ++i) {
+      writeValue(writer, i);
+    }
+
+    // Reader is inside its callback for frame 0 when the writer fills the last free frame
+    std::uint64_t value{};
+    const auto status = reader.visit([&writer, &value](std::span<const std::byte> frame) {
+      writeValue(writer, 42U);
+      std::memcpy(&value, frame.data(), sizeof(value));
+      return true;
+    });
+    REQUIRE(status == (versioned ? Reader::Status::Ok : Reader::Status::Dropped));
+    if (versioned) {
+      REQUIRE(value == 0U);
+    }
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Versioned frame overwritten during read is reported as Dropped", "[spmcq]") {
+  static constexpr auto CAPACITY = 4UZ;
+  const auto name = uniqueName();
+  const auto config = Config{ .frame_length = 8U, .num_frames = CAPACITY, .versioned = true };
+  auto maybe_writer = Writer::create(name, config);
+  REQUIRE(maybe_writer);
+  auto& writer = maybe_writer.value();
+  auto maybe_reader = Reader::connect(name);
+  REQUIRE(maybe_reader);
+  auto& reader = maybe_reader.value();
+
+  for (auto i = 0UZ; i < CAPACITY; ++i) {
+    writeValue(writer, i);
+  }
+
+  // next write lands on frame 0, which the reader is reading
+  const auto status = reader.visit([&writer](std::span<const std::byte>) {
+    writeValue(writer, 42U);
+    return true;
+  });
+  REQUIRE(status == Reader::Status::Dropped);
+
+  // frame being written by a batch that has not completed is also reported
+  for (auto i = 0UZ; i < CAPACITY - 1U; ++i) {
+    writeValue(writer, i);
+  }
+  const auto batch_status = reader.visit([&writer](std::span<const std::byte>) {
+    const auto batch_fn = [](std::span<std::byte>, std::span<std::byte>) { return false; };
+    std::ignore = writer.visitBatch(CAPACITY, batch_fn);
+    return true;
+  });
+  REQUIRE(batch_status == Reader::Status::Dropped);
+}
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
 
 }  // namespace
@@ -0,0 +1,320 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <format>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+
+#include "catch2/catch_test_macros.hpp"
+#include "grape/realtime/spmcq_var.h"
+#include "grape/shared_memory.h"
+#include "grape/wall_clock.h"
+
+namespace {
+
+using VarConfig = grape::spmcq::VarConfig;
+using VarReader = grape::spmcq::VarReader;
+using VarWriter = grape::spmcq::VarWriter;
+
+//-------------------------------------------------------------------------------------------------
+auto uniqueName() -> std::string {
+  return std::format("spmcq_var_test_{}", grape::WallClock::now().time_since_epoch().count());
+}
+
+//-------------------------------------------------------------------------------------------------
+// Helpers to write/read a string record via the visitor interface.
+auto writeString(VarWriter& writer, std::string_view str) -> bool {
+  return writer.visit(str.size(), [&str](std::span<std::byte> buffer) -> std::size_t {
+    std::memcpy(buffer.data(), str.data(), str.size());
+    return str.size();
+  });
+}
+
+auto readString(VarReader& reader, VarReader::Policy policy = VarReader::Policy::Next)
+    -> std::pair<VarReader::Status, std::string> {
+  std::string str;
+  const auto status = reader.visit(
+      [&str](std::span<const std::byte> record) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        str.assign(reinterpret_cast<const char*>(record.data()), record.size());
+        return true;
+      },
+      policy);
+  return { status, str };
+}
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("[Var] Invalid config returns error", "[spmcq]") {
+  REQUIRE_FALSE(VarWriter::create(uniqueName(), VarConfig{ .capacity = 0U }));
+  REQUIRE_FALSE(VarWriter::create(uniqueName(), VarConfig{ .capacity = 32U }));
+  REQUIRE_FALSE(VarWriter::create(uniqueName(), VarConfig{ .capacity = 100U }));
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("[Var] Read from empty buffer returns Empty", "[spmcq]") {
+  const auto name = uniqueName();
+  auto maybe_writer = VarWriter::create(name, VarConfig{ .capacity = 256U });
+  REQUIRE(maybe_writer);
+  auto maybe_reader = VarReader::connect(name);
+  REQUIRE(maybe_reader);
+
+  REQUIRE(readString(maybe_reader.value()).first == VarReader::Status::Empty);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("[Var] Records of different lengths round-trip in order", "[spmcq]") {
+  const auto name = uniqueName();
+  auto maybe_writer = VarWriter::create(name, VarConfig{ .capacity = 256U });
+  REQUIRE(maybe_writer);
+  auto& writer = maybe_writer.value();
+  auto maybe_reader = VarReader::connect(name);
+  REQUIRE(maybe_reader);
+  auto& reader = maybe_reader.value();
+
+  static constexpr auto RECORDS =
+      std::array<std::string_view, 4U>{ "a", "hello world", "", "0123456789abcdefghij" };
+  for (const auto& rec : RECORDS) {
+    if (rec.empty()) {
+      REQUIRE_FALSE(writeString(writer, rec));  // zero-length records are not supported
+    } else {
+      REQUIRE(writeString(writer, rec));
+    }
+  }
+  for (const auto& rec : RECORDS) {
+    if (rec.empty()) {
+      continue;
+    }
+    const auto [status, str] = readString(reader);
+    REQUIRE(status == VarReader::Status::Ok);
+    REQUIRE(str == rec);
+  }
+  REQUIRE(reader.sequence() == 3U);
+  REQUIRE(readString(reader).first == VarReader::Status::Empty);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("[Var] Records wrap around the end of the ring", "[spmcq]") {
+  static constexpr auto CAPACITY = 128UZ;
+  const auto name = uniqueName();
+  auto maybe_writer = VarWriter::create(name, VarConfig{ .capacity = CAPACITY });
+  REQUIRE(maybe_writer);
+  auto& writer = maybe_writer.value();
+  auto maybe_reader = VarReader::connect(name);
+  REQUIRE(maybe_reader);
+  auto& reader = maybe_reader.value();
+
+  // Each 40 byte record takes 64 bytes of ring with its header, so the ring wraps every 2 records
+  for (auto i = 0; i < 10; ++i) {
+    const auto rec = std::string(40U, static_cast<char>('a' + i));
+    REQUIRE(writeString(writer, rec));
+    const auto [status, str] = readString(reader);
+    REQUIRE(status == VarReader::Status::Ok);
+    REQUIRE(str == rec);
+  }
+
+  // A 20 byte record takes 48 bytes, leaving 16 bytes of padding before the end of the ring
+  for (auto i = 0; i < 10; ++i) {
+    const auto rec = std::string(20U, static_cast<char>('A' + i));
+    REQUIRE(writeString(writer, rec));
+    const auto [status, str] = readString(reader);
+    REQUIRE(status == VarReader::Status::Ok);
+    REQUIRE(str == rec);
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("[Var] Record larger than half the capacity is rejected", "[spmcq]") {
+  const auto name = uniqueName();
+  auto maybe_writer = VarWriter::create(name, VarConfig{ .capacity = 128U });
+  REQUIRE(maybe_writer);
+  auto& writer = maybe_writer.value();
+  REQUIRE(writer.maxRecordLength() == 48U);
+  REQUIRE(writeString(writer, std::string(48U, 'x')));
+  REQUIRE_FALSE(writeString(writer, std::string(49U, 'x')));
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("[Var] Writer reserving more than it writes consumes only what was written", "[spmcq]") {
+  const auto name = uniqueName();
+  auto maybe_writer = VarWriter::create(name, VarConfig{ .capacity = 256U });
+  REQUIRE(maybe_writer);
+  auto& writer = maybe_writer.value();
+  auto maybe_reader = VarReader::connect(name);
+  REQUIRE(maybe_reader);
+  auto& reader = maybe_reader.value();
+
+  for (auto i = 0; i < 20; ++i) {
+    REQUIRE(writer.visit(writer.maxRecordLength(), [](std::span<std::byte> buffer) {
+      buffer.front() = std::byte{ 'z' };
+      return 1UZ;
+    }));
+    const auto [status, str] = readString(reader);
+    REQUIRE(status == VarReader::Status::Ok);
+    REQUIRE(str == "z");
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("[Var] Aborted write does not publish a record", "[spmcq]") {
+  const auto name = uniqueName();
+  auto maybe_writer = VarWriter::create(name, VarConfig{ .capacity = 256U });
+  REQUIRE(maybe_writer);
+  auto& writer = maybe_writer.value();
+  auto maybe_reader = VarReader::connect(name);
+  REQUIRE(maybe_reader);
+  auto& reader = maybe_reader.value();
+
+  REQUIRE_FALSE(writer.visit(8U, [](std::span<std::byte>) { return 0UZ; }));
+  REQUIRE_FALSE(writer.visit(8U, [](std::span<std::byte>) { return 9UZ; }));
+  REQUIRE(readString(reader).first == VarReader::Status::Empty);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("[Var] Writer lapping reader returns Dropped, then reader catches up", "[spmcq]") {
+  const auto name = uniqueName();
+  auto maybe_writer = VarWriter::create(name, VarConfig{ .capacity = 128U });
+  REQUIRE(maybe_writer);
+  auto& writer = maybe_writer.value();
+  auto maybe_reader = VarReader::connect(name);
+  REQUIRE(maybe_reader);
+  auto& reader = maybe_reader.value();
+
+  for (auto i = 0; i < 5; ++i) {
+    REQUIRE(writeString(writer, "lapping"));
+  }
+  REQUIRE(readString(reader).first == VarReader::Status::Dropped);
+  REQUIRE(readString(reader).first == VarReader::Status::Empty);
+
+  REQUIRE(writeString(writer, "fresh"));
+  const auto [status, str] = readString(reader);
+  REQUIRE(status == VarReader::Status::Ok);
+  REQUIRE(str == "fresh");
+  REQUIRE(reader.sequence() == 6U);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("[Var] Reader policy Latest skips to latest record", "[spmcq]") {
+  const auto name = uniqueName();
+  auto maybe_writer = VarWriter::create(name, VarConfig{ .capacity = 256U });
+  REQUIRE(maybe_writer);
+  auto& writer = maybe_writer.value();
+  auto maybe_reader = VarReader::connect(name);
+  REQUIRE(maybe_reader);
+  auto& reader = maybe_reader.value();
+
+  REQUIRE(writeString(writer, "one"));
+  REQUIRE(writeString(writer, "two"));
+  REQUIRE(writeString(writer, "three"));
+
+  REQUIRE(readString(reader).second == "one");
+  const auto [status, str] = readString(reader, VarReader::Policy::Latest);
+  REQUIRE(status == VarReader::Status::Ok);
+  REQUIRE(str == "three");
+  REQUIRE(reader.sequence() == 3U);
+  REQUIRE(readString(reader, VarReader::Policy::Latest).first == VarReader::Status::Empty);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("[Var] Reader does not advance if read function returns false", "[spmcq]") {
+  const auto name = uniqueName();
+  auto maybe_writer = VarWriter::create(name, VarConfig{ .capacity = 256U });
+  REQUIRE(maybe_writer);
+  auto& writer = maybe_writer.value();
+  auto maybe_reader = VarReader::connect(name);
+  REQUIRE(maybe_reader);
+  auto& reader = maybe_reader.value();
+
+  REQUIRE(writeString(writer, "keep"));
+  REQUIRE(reader.visit([](std::span<const std::byte>) { return false; }) ==
+          VarReader::Status::Canceled);
+  REQUIRE(readString(reader).second == "keep");
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("[Var] Non-empty metadata is accessible to reader", "[spmcq]") {
+  const auto name = uniqueName();
+  static constexpr std::array<std::byte, 3U> META{ std::byte{ 0x01 }, std::byte{ 0x02 },
+                                                   std::byte{ 0x03 } };
+  auto maybe_writer = VarWriter::create(name, VarConfig{ .capacity = 64U }, META);
+  REQUIRE(maybe_writer);
+  auto maybe_reader = VarReader::connect(name);
+  REQUIRE(maybe_reader);
+
+  const auto meta = maybe_reader.value().metadata();
+  REQUIRE(std::ranges::equal(meta, META));
+  REQUIRE(maybe_reader.value().config().capacity == 64U);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("[Var] Connect to buffer with a different layout version returns error", "[spmcq]") {
+  const auto name = uniqueName();
+  auto maybe_writer = VarWriter::create(name, VarConfig{ .capacity = 64U });
+  REQUIRE(maybe_writer);
+  REQUIRE(VarReader::connect(name));
+
+  // The layout version follows the 8-byte magic at the start of the region
+  auto shm = grape::SharedMemory::open("/" + name, grape::SharedMemory::Access::ReadWrite);
+  REQUIRE(shm);
+  auto version = std::uint32_t{};
+  std::memcpy(&version, shm->data().subspan(sizeof(std::uint64_t)).data(), sizeof(version));
+  version += 1U;
+  std::memcpy(shm->data().subspan(sizeof(std::uint64_t)).data(), &version, sizeof(version));
+
+  const auto maybe_reader = VarReader::connect(name);
+  REQUIRE_FALSE(maybe_reader);
+  REQUIRE(maybe_reader.error().message().contains("layout version"));
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("[Var] Concurrent writer and blocking reader", "[spmcq]") {
+  static constexpr auto NUM_WRITES = 1000UZ;
+  const auto name = uniqueName();
+  auto maybe_writer = VarWriter::create(name, VarConfig{ .capacity = 64UZ * 1024UZ });
+  REQUIRE(maybe_writer);
+  auto maybe_reader = VarReader::connect(name);
+  REQUIRE(maybe_reader);
+  auto& writer = maybe_writer.value();
+  auto& reader = maybe_reader.value();
+
+  std::thread producer([&writer]() {
+    for (auto i = 0UZ; i < NUM_WRITES; ++i) {
+      std::ignore = writeString(writer, std::to_string(i));
+    }
+  });
+
+  static constexpr auto TIMEOUT = std::chrono::milliseconds(1000);
+  auto reads = 0UZ;
+  auto in_order = true;
+  while (reads < NUM_WRITES) {
+    std::string str;
+    const auto status = reader.waitVisit(
+        [&str](std::span<const std::byte> record) {
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+          str.assign(reinterpret_cast<const char*>(record.data()), record.size());
+          return true;
+        },
+        TIMEOUT);
+    if (status != VarReader::Status::Ok) {
+      break;
+    }
+    in_order = in_order and (str == std::to_string(reads));
+    ++reads;
+  }
+  producer.join();
+  REQUIRE(reads == NUM_WRITES);
+  REQUIRE(in_order);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
+
+}  // namespace
@@ -111,13 +111,16 @@ void bmMsgpackDeserialize(benchmark::State& state) {
 }
 
 //-------------------------------------------------------------------------------------------------
+// Serialisation with the given wire encoding. Reports size of the encoded data as a counter
+template <grape::serdes::EncodingPolicy Encoding>
 void bmGrapeSerialize(benchmark::State& state) {
   const auto p = generatePerson();
   auto buf = grape::serdes::OutStream<BUFFER_INIT_SIZE>();
 
   for (auto s : state) {
     (void)s;
-    auto serializer = grape::serdes::Serialiser(buf);
+    buf.reset();
+    auto serializer = grape::serdes::Serialiser<decltype(buf), Encoding>(buf);
     if (not serializer.pack(p)) {
       throw std::runtime_error("Serialisation error");
     }
@@ -125,15 +128,17 @@ void bmGrapeSerialize(benchmark::State& state) {
     benchmark::DoNotOptimize(buf.data());
     benchmark::ClobberMemory();
   }
+  state.counters["encoded_bytes"] = static_cast<double>(buf.size());
 }
 
 //-------------------------------------------------------------------------------------------------
+template <grape::serdes::EncodingPolicy Encoding>
 void bmGrapeDeserialize(benchmark::State& state) {
   // Create a serialized buffer to use in deserialization
   const auto p = generatePerson();
 
   auto obuf = grape::serdes::OutStream<BUFFER_INIT_SIZE>();
-  auto serializer = grape::serdes::Serialiser(obuf);
+  auto serializer = grape::serdes::Serialiser<decltype(obuf), Encoding>(obuf);
   if (not serializer.pack(p)) {
     throw std::runtime_error("Serialisation error");
   }
@@ -141,12 +146,13 @@ void bmGrapeDeserialize(benchmark::State& state) {
   for (auto s : state) {
     (void)s;
     auto ibuf = grape::serdes::InStream({ obuf.data(), obuf.size() });
-    auto deserializer = grape::serdes::Deserialiser(ibuf);
+    auto deserializer = grape::serdes::Deserialiser<grape::serdes::InStream, Encoding>(ibuf);
     Person deserialized_person;
     if (not deserializer.unpack(deserialized_person)) {
       throw std::runtime_error("Deserialisation error");
     }
   }
+  state.counters["encoded_bytes"] = static_cast<double>(obuf.size());
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -305,8 +311,12 @@ void bmFlexBufferDeserialize(benchmark::State& state) {
   }
 }
 
-BENCHMARK(bmGrapeSerialize);
-BENCHMARK(bmGrapeDeserialize);
+BENCHMARK_TEMPLATE(bmGrapeSerialize, grape::serdes::FixedEncoding);
+BENCHMARK_TEMPLATE(bmGrapeDeserialize, grape::serdes::FixedEncoding);
+BENCHMARK_TEMPLATE(bmGrapeSerialize, grape::serdes::CompactEncoding);
+BENCHMARK_TEMPLATE(bmGrapeDeserialize, grape::serdes::CompactEncoding);
+BENCHMARK_TEMPLATE(bmGrapeSerialize, grape::serdes::CompactIntegerEncoding);
+BENCHMARK_TEMPLATE(bmGrapeDeserialize, grape::serdes::CompactIntegerEncoding);
 BENCHMARK(bmFastCDRSerialize);
 BENCHMARK(bmFastCDRDeserialize);
 BENCHMARK(bmCDRSerialize);
@@ -2,7 +2,16 @@
 // Copyright (C) 2024 GRAPE Contributors
 //=================================================================================================
 
+#include <algorithm>
+#include <concepts>
+#include <deque>
+#include <format>
+#include <map>
+#include <optional>
 #include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <benchmark/benchmark.h>
 
@@ -80,8 +89,288 @@ void bmDeserialize(benchmark::State& state) {
   }
 }
 
+//-------------------------------------------------------------------------------------------------
+// Packs PoseStamped member by member, as Serialiser would if it could not copy it in bulk
+auto packFieldwise(Serialiser& ser, const PoseStamped& pose) -> bool {
+  const auto& [x, y, z] = pose.position;
+  const auto& [qx, qy, qz, qw] = pose.orientation;
+  return ser.pack(pose.nanoseconds) && ser.pack(x) && ser.pack(y) && ser.pack(z) &&
+         ser.pack(qx) && ser.pack(qy) && ser.pack(qz) && ser.pack(qw);
+}
+
+//-------------------------------------------------------------------------------------------------
+void bmSerializeFieldwise(benchmark::State& state) {
+  static_assert(grape::serdes::detail::BulkCopyable<PoseStamped>);
+  const auto pos = PoseStamped();
+  auto buf = OutStream();
+  auto serializer = Serialiser(buf);
+
+  for (auto st : state) {
+    (void)st;
+    buf.reset();
+    if (not packFieldwise(serializer, pos)) {
+      throw std::runtime_error("Serialisation error");
+    }
+
+    benchmark::DoNotOptimize(buf);
+    benchmark::ClobberMemory();
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+struct Point3f {
+  float x{};
+  float y{};
+  float z{};
+};
+
+constexpr auto MIN_CLOUD_SIZE = 64;
+constexpr auto MAX_CLOUD_SIZE = 64 * 1024;
+constexpr auto CLOUD_SIZE_MULTIPLIER = 8;
+
+//-------------------------------------------------------------------------------------------------
+auto generateCloud(std::size_t num_points) -> std::vector<Point3f> {
+  auto cloud = std::vector<Point3f>(num_points);
+  for (auto i = 0UZ; i < num_points; ++i) {
+    const auto v = static_cast<float>(i);
+    cloud.at(i) = { .x = v, .y = -v, .z = 2.F * v };
+  }
+  return cloud;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Packs the cloud element by element, member by member, as before vectors of aggregates were
+// supported
+auto packPerElement(grape::serdes::Serialiser<grape::serdes::ArenaOutStream>& ser,
+                    const std::vector<Point3f>& cloud) -> bool {
+  if (not ser.pack(cloud.size())) {
+    return false;
+  }
+  return std::ranges::all_of(cloud, [&ser](const Point3f& point) {
+    return ser.pack(point.x) && ser.pack(point.y) && ser.pack(point.z);
+  });
+}
+
+//-------------------------------------------------------------------------------------------------
+void bmSerializeCloud(benchmark::State& state) {
+  const auto cloud = generateCloud(static_cast<std::size_t>(state.range(0)));
+  auto buf = grape::serdes::ArenaOutStream();
+  auto serializer = grape::serdes::Serialiser(buf);
+  for (auto st : state) {
+    (void)st;
+    buf.reset();
+    if (not serializer.pack(cloud)) {
+      throw std::runtime_error("Serialisation error");
+    }
+    benchmark::DoNotOptimize(buf.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+//-------------------------------------------------------------------------------------------------
+void bmSerializeCloudPerElement(benchmark::State& state) {
+  const auto cloud = generateCloud(static_cast<std::size_t>(state.range(0)));
+  auto buf = grape::serdes::ArenaOutStream();
+  auto serializer = grape::serdes::Serialiser(buf);
+  for (auto st : state) {
+    (void)st;
+    buf.reset();
+    if (not packPerElement(serializer, cloud)) {
+      throw std::runtime_error("Serialisation error");
+    }
+    benchmark::DoNotOptimize(buf.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+//-------------------------------------------------------------------------------------------------
+void bmDeserializeCloud(benchmark::State& state) {
+  auto obuf = grape::serdes::ArenaOutStream();
+  auto serializer = grape::serdes::Serialiser(obuf);
+  if (not serializer.pack(generateCloud(static_cast<std::size_t>(state.range(0))))) {
+    throw std::runtime_error("Serialisation error");
+  }
+  auto cloud = std::vector<Point3f>{};
+  for (auto st : state) {
+    (void)st;
+    auto ibuf = InStream(obuf.data());
+    auto deserializer = Deserialiser(ibuf);
+    if (not deserializer.unpack(cloud)) {
+      throw std::runtime_error("Deserialisation error");
+    }
+    benchmark::DoNotOptimize(cloud.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+//-------------------------------------------------------------------------------------------------
+void bmDeserializeCloudPerElement(benchmark::State& state) {
+  auto obuf = grape::serdes::ArenaOutStream();
+  auto serializer = grape::serdes::Serialiser(obuf);
+  if (not serializer.pack(generateCloud(static_cast<std::size_t>(state.range(0))))) {
+    throw std::runtime_error("Serialisation error");
+  }
+  auto cloud = std::vector<Point3f>{};
+  for (auto st : state) {
+    (void)st;
+    auto ibuf = InStream(obuf.data());
+    auto deserializer = Deserialiser(ibuf);
+    auto num_points = 0UZ;
+    if (not deserializer.unpack(num_points)) {
+      throw std::runtime_error("Deserialisation error");
+    }
+    cloud.resize(num_points);
+    for (auto& point : cloud) {
+      if (not(deserializer.unpack(point.x) && deserializer.unpack(point.y) &&
+              deserializer.unpack(point.z))) {
+        throw std::runtime_error("Deserialisation error");
+      }
+    }
+    benchmark::DoNotOptimize(cloud.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+//-------------------------------------------------------------------------------------------------
+// Decodes the row-wise encoding of the cloud straight into column buffers
+void bmDeserializeCloudColumns(benchmark::State& state) {
+  auto obuf = grape::serdes::ArenaOutStream();
+  auto serializer = grape::serdes::Serialiser(obuf);
+  if (not serializer.pack(generateCloud(static_cast<std::size_t>(state.range(0))))) {
+    throw std::runtime_error("Serialisation error");
+  }
+  auto columns = grape::serdes::Columns<Point3f>{};
+  for (auto st : state) {
+    (void)st;
+    auto ibuf = InStream(obuf.data());
+    auto deserializer = Deserialiser(ibuf);
+    if (not deserializer.unpack(columns)) {
+      throw std::runtime_error("Deserialisation error");
+    }
+    benchmark::DoNotOptimize(columns.column<0>().data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+//-------------------------------------------------------------------------------------------------
+// Containers of non-trivial elements, filled with n elements
+template <typename C>
+auto generateContainer(std::size_t n) -> C {
+  auto container = C{};
+  for (auto i = 0UZ; i < n; ++i) {
+    const auto value = static_cast<double>(i);
+    if constexpr (std::same_as<C, std::vector<std::string>>) {
+      container.push_back(std::format("element_{}", i));
+    } else if constexpr (std::same_as<C, std::vector<std::optional<double>>>) {
+      container.push_back((i % 2 == 0) ? std::optional{ value } : std::nullopt);
+    } else if constexpr (std::same_as<C, std::deque<std::int32_t>>) {
+      container.push_back(static_cast<std::int32_t>(i));
+    } else {
+      container.emplace(static_cast<typename C::key_type>(i), value);
+    }
+  }
+  return container;
+}
+
+//-------------------------------------------------------------------------------------------------
+template <typename C>
+void bmSerializeContainer(benchmark::State& state) {
+  const auto container = generateContainer<C>(static_cast<std::size_t>(state.range(0)));
+  auto buf = grape::serdes::ArenaOutStream();
+  auto serializer = grape::serdes::Serialiser(buf);
+  for (auto st : state) {
+    (void)st;
+    buf.reset();
+    if (not serializer.pack(container)) {
+      throw std::runtime_error("Serialisation error");
+    }
+    benchmark::DoNotOptimize(buf.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+//-------------------------------------------------------------------------------------------------
+// Decodes into the same container every iteration, as a subscriber would
+template <typename C>
+void bmDeserializeContainer(benchmark::State& state) {
+  auto obuf = grape::serdes::ArenaOutStream();
+  auto serializer = grape::serdes::Serialiser(obuf);
+  if (not serializer.pack(generateContainer<C>(static_cast<std::size_t>(state.range(0))))) {
+    throw std::runtime_error("Serialisation error");
+  }
+  auto container = C{};
+  for (auto st : state) {
+    (void)st;
+    auto ibuf = InStream(obuf.data());
+    auto deserializer = Deserialiser(ibuf);
+    if (not deserializer.unpack(container)) {
+      throw std::runtime_error("Deserialisation error");
+    }
+    benchmark::DoNotOptimize(container);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+constexpr auto MIN_CONTAINER_SIZE = 8;
+constexpr auto MAX_CONTAINER_SIZE = 8 * 1024;
+constexpr auto CONTAINER_SIZE_MULTIPLIER = 8;
+
 BENCHMARK(bmSerialize);
+BENCHMARK(bmSerializeFieldwise);
 BENCHMARK(bmDeserialize);
+BENCHMARK(bmSerializeCloud)
+    ->RangeMultiplier(CLOUD_SIZE_MULTIPLIER)
+    ->Range(MIN_CLOUD_SIZE, MAX_CLOUD_SIZE);
+BENCHMARK(bmSerializeCloudPerElement)
+    ->RangeMultiplier(CLOUD_SIZE_MULTIPLIER)
+    ->Range(MIN_CLOUD_SIZE, MAX_CLOUD_SIZE);
+BENCHMARK(bmDeserializeCloud)
+    ->RangeMultiplier(CLOUD_SIZE_MULTIPLIER)
+    ->Range(MIN_CLOUD_SIZE, MAX_CLOUD_SIZE);
+BENCHMARK(bmDeserializeCloudPerElement)
+    ->RangeMultiplier(CLOUD_SIZE_MULTIPLIER)
+    ->Range(MIN_CLOUD_SIZE, MAX_CLOUD_SIZE);
+BENCHMARK(bmDeserializeCloudColumns)
+    ->RangeMultiplier(CLOUD_SIZE_MULTIPLIER)
+    ->Range(MIN_CLOUD_SIZE, MAX_CLOUD_SIZE);
+
+BENCHMARK_TEMPLATE(bmSerializeContainer, std::vector<std::string>)
+    ->RangeMultiplier(CONTAINER_SIZE_MULTIPLIER)
+    ->Range(MIN_CONTAINER_SIZE, MAX_CONTAINER_SIZE);
+BENCHMARK_TEMPLATE(bmDeserializeContainer, std::vector<std::string>)
+    ->RangeMultiplier(CONTAINER_SIZE_MULTIPLIER)
+    ->Range(MIN_CONTAINER_SIZE, MAX_CONTAINER_SIZE);
+BENCHMARK_TEMPLATE(bmSerializeContainer, std::vector<std::optional<double>>)
+    ->RangeMultiplier(CONTAINER_SIZE_MULTIPLIER)
+    ->Range(MIN_CONTAINER_SIZE, MAX_CONTAINER_SIZE);
+BENCHMARK_TEMPLATE(bmDeserializeContainer, std::vector<std::optional<double>>)
+    ->RangeMultiplier(CONTAINER_SIZE_MULTIPLIER)
+    ->Range(MIN_CONTAINER_SIZE, MAX_CONTAINER_SIZE);
+BENCHMARK_TEMPLATE(bmSerializeContainer, std::deque<std::int32_t>)
+    ->RangeMultiplier(CONTAINER_SIZE_MULTIPLIER)
+    ->Range(MIN_CONTAINER_SIZE, MAX_CONTAINER_SIZE);
+BENCHMARK_TEMPLATE(bmDeserializeContainer, std::deque<std::int32_t>)
+    ->RangeMultiplier(CONTAINER_SIZE_MULTIPLIER)
+    ->Range(MIN_CONTAINER_SIZE, MAX_CONTAINER_SIZE);
+BENCHMARK_TEMPLATE(bmSerializeContainer, std::map<std::uint32_t, double>)
+    ->RangeMultiplier(CONTAINER_SIZE_MULTIPLIER)
+    ->Range(MIN_CONTAINER_SIZE, MAX_CONTAINER_SIZE);
+BENCHMARK_TEMPLATE(bmDeserializeContainer, std::map<std::uint32_t, double>)
+    ->RangeMultiplier(CONTAINER_SIZE_MULTIPLIER)
+    ->Range(MIN_CONTAINER_SIZE, MAX_CONTAINER_SIZE);
+BENCHMARK_TEMPLATE(bmSerializeContainer, std::unordered_map<std::uint32_t, double>)
+    ->RangeMultiplier(CONTAINER_SIZE_MULTIPLIER)
+    ->Range(MIN_CONTAINER_SIZE, MAX_CONTAINER_SIZE);
+BENCHMARK_TEMPLATE(bmDeserializeContainer, std::unordered_map<std::uint32_t, double>)
+    ->RangeMultiplier(CONTAINER_SIZE_MULTIPLIER)
+    ->Range(MIN_CONTAINER_SIZE, MAX_CONTAINER_SIZE);
 
 }  // namespace
 
@@ -0,0 +1,105 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+namespace grape::serdes {
+
+//-------------------------------------------------------------------------------------------------
+// Concept for wire encoding policies of Serialiser and Deserialiser
+template <typename Policy>
+concept EncodingPolicy = requires {
+  { Policy::VARINT_SIZES } -> std::convertible_to<bool>;
+  /* If true, sizes of strings and vectors, and indices of variants, are encoded as varints */
+  { Policy::VARINT_INTEGERS } -> std::convertible_to<bool>;
+  /* If true, integers wider than a byte are encoded as varints */
+};
+
+//=================================================================================================
+/// Default encoding. Every value takes the size of its memory representation, and sizes and
+/// variant indices take 8 bytes. Fastest to encode and decode.
+struct FixedEncoding {
+  static constexpr auto VARINT_SIZES = false;
+  static constexpr auto VARINT_INTEGERS = false;
+};
+
+//=================================================================================================
+/// Sizes and variant indices are encoded as unsigned LEB128 varints, so that they take a single
+/// byte for values under 128. Suits messages with many short strings, vectors or variants.
+struct CompactEncoding {
+  static constexpr auto VARINT_SIZES = true;
+  static constexpr auto VARINT_INTEGERS = false;
+};
+
+//=================================================================================================
+/// As CompactEncoding, and additionally integers wider than a byte (including those underlying
+/// enums, durations and time points) are encoded as LEB128 varints. Signed integers are zigzag
+/// encoded first, so that values of small magnitude are short whatever their sign. Suits messages
+/// dominated by integers of small magnitude, at the cost of encoding and decoding speed.
+struct CompactIntegerEncoding {
+  static constexpr auto VARINT_SIZES = true;
+  static constexpr auto VARINT_INTEGERS = true;
+};
+
+static_assert(EncodingPolicy<FixedEncoding>);
+static_assert(EncodingPolicy<CompactEncoding>);
+static_assert(EncodingPolicy<CompactIntegerEncoding>);
+
+namespace detail {
+
+/// Most bytes taken by a varint of a 64-bit value
+inline constexpr auto MAX_VARINT_SIZE = 10UZ;
+
+inline constexpr auto VARINT_PAYLOAD_BITS = 7U;
+inline constexpr auto VARINT_PAYLOAD_MASK = 0x7FU;
+inline constexpr auto VARINT_CONTINUATION_BIT = 0x80U;
+
+/// @return Number of bytes taken by value encoded as a varint
+[[nodiscard]] constexpr auto varintSize(std::uint64_t value) -> std::size_t {
+  const auto bits = static_cast<std::size_t>(std::bit_width(value));
+  return (bits == 0U) ? 1U : ((bits + VARINT_PAYLOAD_BITS - 1U) / VARINT_PAYLOAD_BITS);
+}
+
+/// Encodes value as unsigned LEB128
+/// @param value Value to encode
+/// @param out Receives the encoded bytes
+/// @return Number of bytes of out used
+[[nodiscard]] constexpr auto encodeVarint(std::uint64_t value,
+                                          std::array<std::byte, MAX_VARINT_SIZE>& out)
+    -> std::size_t {
+  auto len = 0UZ;
+  while (value > VARINT_PAYLOAD_MASK) {
+    out.at(len++) = static_cast<std::byte>((value & VARINT_PAYLOAD_MASK) | VARINT_CONTINUATION_BIT);
+    value >>= VARINT_PAYLOAD_BITS;
+  }
+  out.at(len++) = static_cast<std::byte>(value);
+  return len;
+}
+
+/// Maps signed values to unsigned values such that values of small magnitude map to small values
+[[nodiscard]] constexpr auto zigzagEncode(std::int64_t value) -> std::uint64_t {
+  constexpr auto SIGN_SHIFT = 63;
+  return (static_cast<std::uint64_t>(value) << 1U) ^
+         static_cast<std::uint64_t>(value >> SIGN_SHIFT);
+}
+
+/// Inverse of zigzagEncode
+[[nodiscard]] constexpr auto zigzagDecode(std::uint64_t value) -> std::int64_t {
+  return static_cast<std::int64_t>(value >> 1U) ^ -static_cast<std::int64_t>(value & 1U);
+}
+
+/// Integers that the encoding policy encodes as varints
+template <typename T, typename Policy>
+concept VarintInteger = Policy::VARINT_INTEGERS && std::integral<T> && (sizeof(T) > 1U) &&
+                        (not std::same_as<T, bool>);
+
+}  // namespace detail
+
+}  // namespace grape::serdes
@@ -0,0 +1,197 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "grape/serdes/serdes.h"
+
+namespace grape::serdes {
+
+namespace detail {
+
+/// Kinds of types distinguished in a schema hash
+enum class SchemaTag : std::uint8_t {
+  Bool,
+  Char,
+  SignedInteger,
+  UnsignedInteger,
+  FloatingPoint,
+  Enum,
+  String,
+  Vector,
+  Array,
+  Variant,
+  Duration,
+  TimePoint,
+  Aggregate,
+  Optional,
+  Pair,
+  Set,
+  Map,
+};
+
+/// Folds value into hash using 64-bit FNV-1a, one byte at a time
+[[nodiscard]] constexpr auto hashMix(std::uint64_t hash, std::uint64_t value) -> std::uint64_t {
+  constexpr auto FNV_PRIME = 0x100000001b3ULL;
+  constexpr auto BITS_PER_BYTE = 8U;
+  constexpr auto BYTE_MASK = 0xFFULL;
+  for (auto i = 0U; i < sizeof(value); ++i) {
+    hash ^= (value >> (i * BITS_PER_BYTE)) & BYTE_MASK;
+    hash *= FNV_PRIME;
+  }
+  return hash;
+}
+
+[[nodiscard]] constexpr auto hashMix(std::uint64_t hash, SchemaTag tag) -> std::uint64_t {
+  return hashMix(hash, static_cast<std::uint64_t>(tag));
+}
+
+//-------------------------------------------------------------------------------------------------
+/// Defines how type T contributes to a schema hash. By default, T is a primitive value or an enum
+template <typename T>
+struct SchemaHasher {
+  [[nodiscard]] static constexpr auto hash(std::uint64_t seed) -> std::uint64_t {
+    if constexpr (std::is_enum_v<T>) {
+      return SchemaHasher<std::underlying_type_t<T>>::hash(hashMix(seed, SchemaTag::Enum));
+    } else if constexpr (std::same_as<T, bool>) {
+      return hashMix(seed, SchemaTag::Bool);
+    } else if constexpr (std::same_as<T, char>) {
+      return hashMix(seed, SchemaTag::Char);
+    } else if constexpr (std::floating_point<T>) {
+      return hashMix(hashMix(seed, SchemaTag::FloatingPoint), sizeof(T));
+    } else if constexpr (std::signed_integral<T>) {
+      return hashMix(hashMix(seed, SchemaTag::SignedInteger), sizeof(T));
+    } else if constexpr (std::unsigned_integral<T>) {
+      return hashMix(hashMix(seed, SchemaTag::UnsignedInteger), sizeof(T));
+    } else {
+      static_assert(false, "Type is not serialisable");
+    }
+  }
+};
+
+template <>
+struct SchemaHasher<std::string> {
+  [[nodiscard]] static constexpr auto hash(std::uint64_t seed) -> std::uint64_t {
+    return hashMix(seed, SchemaTag::String);
+  }
+};
+
+template <typename T>
+struct SchemaHasher<std::vector<T>> {
+  [[nodiscard]] static constexpr auto hash(std::uint64_t seed) -> std::uint64_t {
+    return SchemaHasher<T>::hash(hashMix(seed, SchemaTag::Vector));
+  }
+};
+
+// Columns<T> has the encoding of std::vector<T>
+template <typename T>
+struct SchemaHasher<Columns<T>> : SchemaHasher<std::vector<T>> {};
+
+template <typename T, std::size_t N>
+struct SchemaHasher<std::array<T, N>> {
+  [[nodiscard]] static constexpr auto hash(std::uint64_t seed) -> std::uint64_t {
+    return SchemaHasher<T>::hash(hashMix(hashMix(seed, SchemaTag::Array), N));
+  }
+};
+
+template <typename... Types>
+struct SchemaHasher<std::variant<Types...>> {
+  [[nodiscard]] static constexpr auto hash(std::uint64_t seed) -> std::uint64_t {
+    auto hash = hashMix(hashMix(seed, SchemaTag::Variant), sizeof...(Types));
+    ((hash = SchemaHasher<Types>::hash(hash)), ...);
+    return hash;
+  }
+};
+
+/// Durations of the same representation but different periods hash differently, since their
+/// values mean different things
+template <typename Rep, typename Period>
+struct SchemaHasher<std::chrono::duration<Rep, Period>> {
+  [[nodiscard]] static constexpr auto hash(std::uint64_t seed) -> std::uint64_t {
+    auto hash = hashMix(seed, SchemaTag::Duration);
+    hash = hashMix(hashMix(hash, static_cast<std::uint64_t>(Period::num)),
+                   static_cast<std::uint64_t>(Period::den));
+    return SchemaHasher<Rep>::hash(hash);
+  }
+};
+
+/// Time points are hashed by their duration only. Clocks cannot be told apart structurally
+template <typename Clock, typename Duration>
+struct SchemaHasher<std::chrono::time_point<Clock, Duration>> {
+  [[nodiscard]] static constexpr auto hash(std::uint64_t seed) -> std::uint64_t {
+    return SchemaHasher<Duration>::hash(hashMix(seed, SchemaTag::TimePoint));
+  }
+};
+
+/// Sequence containers other than std::vector share its encoding, and so its hash
+template <typename C>
+  requires SequenceContainer<C>
+struct SchemaHasher<C> : SchemaHasher<std::vector<typename C::value_type>> {};
+
+/// Ordered and unordered variants of sets and maps share an encoding, and so a hash
+template <typename C>
+  requires AssociativeContainer<C>
+struct SchemaHasher<C> {
+  [[nodiscard]] static constexpr auto hash(std::uint64_t seed) -> std::uint64_t {
+    if constexpr (MapContainer<C>) {
+      const auto key_hash = SchemaHasher<typename C::key_type>::hash(hashMix(seed, SchemaTag::Map));
+      return SchemaHasher<typename C::mapped_type>::hash(key_hash);
+    } else {
+      return SchemaHasher<typename C::key_type>::hash(hashMix(seed, SchemaTag::Set));
+    }
+  }
+};
+
+template <typename First, typename Second>
+struct SchemaHasher<std::pair<First, Second>> {
+  [[nodiscard]] static constexpr auto hash(std::uint64_t seed) -> std::uint64_t {
+    return SchemaHasher<Second>::hash(SchemaHasher<First>::hash(hashMix(seed, SchemaTag::Pair)));
+  }
+};
+
+template <typename T>
+struct SchemaHasher<std::optional<T>> {
+  [[nodiscard]] static constexpr auto hash(std::uint64_t seed) -> std::uint64_t {
+    return SchemaHasher<T>::hash(hashMix(seed, SchemaTag::Optional));
+  }
+};
+
+/// Aggregates are hashed by the sequence of their member types. Member names do not contribute
+template <typename T>
+  requires SerializableAggregate<T&>
+struct SchemaHasher<T> {
+  [[nodiscard]] static constexpr auto hash(std::uint64_t seed) -> std::uint64_t {
+    auto hash = hashMix(hashMix(seed, SchemaTag::Aggregate), FIELD_COUNT<T>);
+    [&hash]<std::size_t... Is>(std::index_sequence<Is...>) {
+      ((hash = SchemaHasher<FieldType<T, Is>>::hash(hash)), ...);
+    }(std::make_index_sequence<FIELD_COUNT<T>>{});
+    return hash;
+  }
+};
+
+}  // namespace detail
+
+//-------------------------------------------------------------------------------------------------
+/// Computes a hash of the structure of T as encoded by Serialiser, at compile time. Types of the
+/// same structure have the same hash, regardless of their names or the names of their members.
+/// Types of different structure have different hashes with very high probability. Use it to
+/// detect mismatches between the data layouts used at the encoding and decoding ends.
+template <typename T>
+[[nodiscard]] consteval auto schemaHash() -> std::uint64_t {
+  constexpr auto FNV_OFFSET_BASIS = 0xcbf29ce484222325ULL;
+  return detail::SchemaHasher<std::remove_cvref_t<T>>::hash(FNV_OFFSET_BASIS);
+}
+
+}  // namespace grape::serdes
@@ -4,15 +4,23 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <bit>
 #include <chrono>
+#include <cstdint>
+#include <optional>
+#include <ranges>
+#include <span>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <utility>
 #include <variant>
 #include <vector>
 
 #include "grape/serdes/concepts.h"
+#include "grape/serdes/encoding.h"
 
 namespace grape::serdes {
 
@@ -40,12 +48,238 @@ template <SerializableAggregate T>
   }(std::forward<T>(value));
 }
 
+/// Identifies the number of members in aggregate type T. Only used in unevaluated contexts
+template <typename T>
+constexpr auto countFields(T& obj) {
+  auto&& [... fields] = obj;
+  return std::integral_constant<std::size_t, sizeof...(fields)>{};
+}
+
+/// Identifies the type of member at index I in aggregate type T. Only used in unevaluated contexts
+template <std::size_t I, typename T>
+constexpr auto typeOfField(T& obj) {
+  auto&& [... fields] = obj;
+  return std::type_identity<std::remove_cvref_t<decltype(fields...[I])>>{};
+}
+
+/// Number of members in aggregate type T
+template <typename T>
+  requires SerializableAggregate<T&>
+inline constexpr auto FIELD_COUNT = decltype(countFields(std::declval<T&>()))::value;
+
+/// Type of the member at index I in aggregate type T
+template <typename T, std::size_t I>
+  requires SerializableAggregate<T&>
+using FieldType = typename decltype(typeOfField<I>(std::declval<T&>()))::type;
+
+/// @return Reference to the member at index I of aggregate obj
+template <std::size_t I, typename T>
+[[nodiscard]] constexpr auto getField(T& obj) -> auto& {
+  auto& [... fields] = obj;
+  return fields...[I];
+}
+
+template <typename T>
+struct IsStdArray : std::false_type {};
+
+template <typename T, std::size_t N>
+struct IsStdArray<std::array<T, N>> : std::true_type {};
+
+template <typename T>
+struct IsStdVector : std::false_type {};
+
+template <typename T, typename Allocator>
+struct IsStdVector<std::vector<T, Allocator>> : std::true_type {};
+
+/// Sequence containers that grow at the back, other than std::vector and std::string, such as
+/// std::deque and std::list. Encoded as std::vector.
+template <typename C>
+concept SequenceContainer =
+    std::ranges::sized_range<const C> && (not IsStdVector<C>::value) &&
+    (not std::same_as<C, std::string>) && requires(C& container, typename C::value_type&& value) {
+      container.clear();
+      container.emplace_back(std::move(value));
+    };
+
+/// Ordered and unordered sets and maps. Encoded as the number of elements followed by the elements
+/// (key-value pairs for maps) in iteration order.
+template <typename C>
+concept AssociativeContainer =
+    std::ranges::sized_range<const C> && requires(C& container, typename C::value_type&& value) {
+      typename C::key_type;
+      container.clear();
+      container.emplace_hint(container.end(), std::move(value));
+    };
+
+/// Associative containers that map keys to values
+template <typename C>
+concept MapContainer = AssociativeContainer<C> && requires { typename C::mapped_type; };
+
+/// Number of bytes that make up the value of T in memory, if T is a primitive, an enum, a
+/// std::array of such types, or a trivially copyable aggregate with members of such types that
+/// leaves no padding between them. Zero for all other types.
+template <typename T>
+consteval auto packedSize() -> std::size_t {
+  if constexpr (PrimitiveValueType<T> || std::is_enum_v<T>) {
+    return sizeof(T);
+  } else if constexpr (IsStdArray<T>::value) {
+    constexpr auto ELEMENT_SIZE = packedSize<typename T::value_type>();
+    return (ELEMENT_SIZE == sizeof(typename T::value_type)) ? sizeof(T) : 0U;
+  } else if constexpr (SerializableAggregate<T&> && std::is_trivially_copyable_v<T>) {
+    constexpr auto FIELDS_SIZE = []<std::size_t... Is>(std::index_sequence<Is...>) {
+      auto total = 0UZ;
+      auto all_packed = true;
+      ((all_packed = all_packed && (packedSize<FieldType<T, Is>>() != 0U),
+        total += packedSize<FieldType<T, Is>>()),
+       ...);
+      return all_packed ? total : 0U;
+    }(std::make_index_sequence<FIELD_COUNT<T>>{});
+    return (FIELDS_SIZE == sizeof(T)) ? sizeof(T) : 0U;
+  } else {
+    return 0U;
+  }
+}
+
+/// Aggregates whose memory representation is identical to their field-by-field encoding, so that
+/// they can be copied to and from the stream in a single operation. This holds for trivially
+/// copyable aggregates made only of primitives, enums, arrays and nested aggregates of such types,
+/// with no padding anywhere, on a little-endian host.
+template <typename T>
+concept BulkCopyable = SerializableAggregate<T&> && (std::endian::native == std::endian::little) &&
+                       (packedSize<T>() == sizeof(T));
+
+/// Storage for Columns<T>: a vector per member of T
+template <typename T, typename Indices>
+struct ColumnStorage;
+
+template <typename T, std::size_t... Is>
+struct ColumnStorage<T, std::index_sequence<Is...>> {
+  using Type = std::tuple<std::vector<FieldType<T, Is>>...>;
+};
+
+/// Number of elements of T transposed at a time between Columns<T> and its encoding, chosen to
+/// keep the scratch space on the stack within a few kilobytes
+template <typename T>
+inline constexpr auto COLUMN_CHUNK_SIZE = std::max(1UZ, 4096UZ / sizeof(T));
+
+/// Fewest bytes a value of type T can encode into with the given encoding policy. Strings,
+/// containers, optionals and variants take at least their size, presence flag or index.
+template <typename T, EncodingPolicy Encoding>
+consteval auto minSize() -> std::size_t {
+  if constexpr (PrimitiveValueType<T>) {
+    return VarintInteger<T, Encoding> ? 1U : sizeof(T);
+  } else if constexpr (std::is_enum_v<T>) {
+    return minSize<std::underlying_type_t<T>, Encoding>();
+  } else if constexpr (requires { typename T::rep; typename T::period; }) {
+    return minSize<typename T::rep, Encoding>();  // durations
+  } else if constexpr (requires { typename T::clock; typename T::duration; }) {
+    return minSize<typename T::duration, Encoding>();  // time points
+  } else if constexpr (IsStdArray<T>::value) {
+    return std::tuple_size_v<T> * minSize<typename T::value_type, Encoding>();
+  } else if constexpr (requires { typename T::first_type; typename T::second_type; }) {
+    return minSize<typename T::first_type, Encoding>() +
+           minSize<typename T::second_type, Encoding>();  // pairs
+  } else if constexpr (SerializableAggregate<T&>) {
+    return []<std::size_t... Is>(std::index_sequence<Is...>) {
+      return (0UZ + ... + minSize<FieldType<T, Is>, Encoding>());
+    }(std::make_index_sequence<FIELD_COUNT<T>>{});
+  } else if constexpr (requires(const T& value) { value.has_value(); }) {
+    return sizeof(bool);  // optionals
+  } else {
+    return Encoding::VARINT_SIZES ? 1U : sizeof(std::size_t);
+  }
+}
+
 }  // namespace detail
 
+//=================================================================================================
+/// Sequence of aggregates of type T stored column-wise (structure-of-arrays): each member of T is
+/// held in a separate contiguous vector. Suits consumers that process a member across all elements
+/// at once, such as with vector instructions.
+///
+/// Encoded exactly as std::vector<T>, so data encoded from one can be decoded into the other.
+/// Transposition to and from the row-wise encoding happens during (de)serialisation.
+/// @tparam T A fixed-layout aggregate (see detail::BulkCopyable)
+template <typename T>
+  requires detail::BulkCopyable<T>
+class Columns {
+public:
+  static constexpr auto COLUMN_COUNT = detail::FIELD_COUNT<T>;
+
+  /// @return Values of the member at index I of all elements
+  template <std::size_t I>
+  [[nodiscard]] constexpr auto column() -> std::vector<detail::FieldType<T, I>>& {
+    return std::get<I>(columns_);
+  }
+
+  /// @return Values of the member at index I of all elements
+  template <std::size_t I>
+  [[nodiscard]] constexpr auto column() const -> const std::vector<detail::FieldType<T, I>>& {
+    return std::get<I>(columns_);
+  }
+
+  /// @return Number of elements. Valid only if all columns are of the same size
+  [[nodiscard]] constexpr auto size() const -> std::size_t {
+    return std::get<0>(columns_).size();
+  }
+
+  /// @return true if all columns are of the same size, as required for serialisation
+  [[nodiscard]] constexpr auto isUniform() const -> bool {
+    return std::apply(
+        [n = size()](const auto&... cols) { return ((cols.size() == n) && ...); }, columns_);
+  }
+
+  /// Resize all columns to n elements
+  constexpr void resize(std::size_t n) {
+    std::apply([n](auto&... cols) { (cols.resize(n), ...); }, columns_);
+  }
+
+  /// Append an element
+  constexpr void append(const T& row) {
+    forEachColumn(
+        [this, &row]<std::size_t I>() { column<I>().push_back(detail::getField<I>(row)); });
+  }
+
+  /// Copy elements starting at index 'first' out into rows
+  constexpr void gather(std::size_t first, std::span<T> rows) const {
+    forEachColumn([this, first, rows]<std::size_t I>() {
+      const auto& col = column<I>();
+      for (auto i = 0UZ; i < rows.size(); ++i) {
+        detail::getField<I>(rows[i]) = col[first + i];
+      }
+    });
+  }
+
+  /// Copy rows into elements starting at index 'first'
+  constexpr void scatter(std::size_t first, std::span<const T> rows) {
+    forEachColumn([this, first, rows]<std::size_t I>() {
+      auto& col = column<I>();
+      for (auto i = 0UZ; i < rows.size(); ++i) {
+        col[first + i] = detail::getField<I>(rows[i]);
+      }
+    });
+  }
+
+private:
+  constexpr void forEachColumn(auto&& fn) const {
+    [&fn]<std::size_t... Is>(std::index_sequence<Is...>) {
+      (fn.template operator()<Is>(), ...);
+    }(std::make_index_sequence<COLUMN_COUNT>{});
+  }
+
+  typename detail::ColumnStorage<T, std::make_index_sequence<COLUMN_COUNT>>::Type columns_;
+};
+
 //=================================================================================================
 /// @brief Simple serialiser that just packs bytes into a stream buffer
+///
+/// Aggregates are encoded member by member, in declaration order. Aggregates that satisfy
+/// detail::BulkCopyable have the same encoding as their memory representation and are copied
+/// into the stream in a single write instead.
 /// @tparam Stream Writable stream buffer
-template <WritableStream Stream>
+/// @tparam Encoding Wire encoding policy. See FixedEncoding, CompactEncoding and
+/// CompactIntegerEncoding. Data must be decoded with the policy it was encoded with
+template <WritableStream Stream, EncodingPolicy Encoding = FixedEncoding>
 class Serialiser {
 public:
   /// Initialise with a stream buffer
@@ -89,35 +323,171 @@ public:
     return pack(std::span<const T>{ data.data(), data.size() });
   }
 
+  template <typename T>
+  [[nodiscard]] constexpr auto pack(const std::vector<T>& data) -> bool {
+    const auto start = stream_.size();
+    if (not packSize(data.size())) {
+      return false;
+    }
+    if (not packElements(std::span<const T>{ data.data(), data.size() })) {
+      stream_.rewind(stream_.size() - start);  // undo encoding size and elements
+      return false;
+    }
+    return true;
+  }
+
+  template <typename T, std::size_t N>
+    requires(not PrimitiveValueType<T>)
+  [[nodiscard]] constexpr auto pack(const std::array<T, N>& data) -> bool {
+    return packElements(std::span<const T>{ data.data(), data.size() });
+  }
+
+  template <typename C>
+    requires detail::SequenceContainer<C> || detail::AssociativeContainer<C>
+  [[nodiscard]] constexpr auto pack(const C& data) -> bool {
+    const auto start = stream_.size();
+    if (not packSize(std::ranges::size(data))) {
+      return false;
+    }
+    const auto pack_element = [this](const auto& element) { return this->pack(element); };
+    if (not std::ranges::all_of(data, pack_element)) {
+      stream_.rewind(stream_.size() - start);  // undo encoding size and elements
+      return false;
+    }
+    return true;
+  }
+
+  template <typename First, typename Second>
+  [[nodiscard]] constexpr auto pack(const std::pair<First, Second>& value) -> bool {
+    return this->pack(value.first) && this->pack(value.second);
+  }
+
+  /// Encoded as a bool that is true if a value is present, followed by the value if so
+  template <typename T>
+  [[nodiscard]] constexpr auto pack(const std::optional<T>& value) -> bool {
+    if (not this->pack(value.has_value())) {
+      return false;
+    }
+    if (value.has_value() && (not this->pack(*value))) {
+      stream_.rewind(sizeof(bool));  // undo encoding presence
+      return false;
+    }
+    return true;
+  }
+
+  template <typename T>
+  [[nodiscard]] constexpr auto pack(const Columns<T>& data) -> bool {
+    const auto start = stream_.size();
+    if ((not data.isUniform()) or (not packSize(data.size()))) {
+      return false;
+    }
+    auto rows = std::array<T, detail::COLUMN_CHUNK_SIZE<T>>{};
+    for (auto first = 0UZ; first < data.size(); first += rows.size()) {
+      const auto chunk = std::span{ rows }.first(std::min(rows.size(), data.size() - first));
+      data.gather(first, chunk);
+      if (not packElements(std::span<const T>{ chunk })) {
+        stream_.rewind(stream_.size() - start);  // undo encoding size and elements
+        return false;
+      }
+    }
+    return true;
+  }
+
   template <typename... Types>
   [[nodiscard]] constexpr auto pack(const std::variant<Types...>& value) -> bool {
-    if (not this->pack(value.index())) {
+    if (not packSize(value.index())) {
       return false;
     }
-    return std::visit([this](const auto& val) { return this->pack(val); }, value);
+    if (not std::visit([this](const auto& val) { return this->pack(val); }, value)) {
+      stream_.rewind(encodedSizeOfSize(value.index()));  // undo encoding index
+      return false;
+    }
+    return true;
   }
 
   template <typename T>
     requires detail::SerializableAggregate<const T&>
   [[nodiscard]] constexpr auto pack(const T& value) -> bool {
+    if constexpr (detail::BulkCopyable<T> && not Encoding::VARINT_INTEGERS) {
+      if !consteval {
+        return stream_.write(std::as_bytes(std::span{ &value, 1U }));
+      }
+    }
     return detail::processMembers(value, [this](const auto& field) { return this->pack(field); });
   }
 
 private:
+  /// Encodes a sequence of elements, in a single write if their layout allows
+  template <typename T>
+  [[nodiscard]] constexpr auto packElements(std::span<const T> data) -> bool {
+    if constexpr (detail::BulkCopyable<T> && not Encoding::VARINT_INTEGERS) {
+      if !consteval {
+        return stream_.write(std::as_bytes(data));
+      }
+    }
+    return std::ranges::all_of(data, [this](const T& value) { return this->pack(value); });
+  }
+
   template <PrimitiveValueType T>
   [[nodiscard]] constexpr auto packWithSize(std::span<const T> data) -> bool {
-    if (not pack(data.size())) {
+    if (not packSize(data.size())) {
       return false;
     }
     if (not pack(data)) {
-      stream_.rewind(sizeof(std::size_t));  // undo encoding data size
+      stream_.rewind(encodedSizeOfSize(data.size()));  // undo encoding data size
       return false;
     }
     return true;
   }
 
+  /// Encodes size of a sequence or index of a variant
+  [[nodiscard]] constexpr auto packSize(std::size_t size) -> bool {
+    if constexpr (Encoding::VARINT_SIZES) {
+      return packVarint(size);
+    } else {
+      return write(std::span<const std::size_t>{ &size, 1U });
+    }
+  }
+
+  [[nodiscard]] static constexpr auto encodedSizeOfSize(std::size_t size) -> std::size_t {
+    if constexpr (Encoding::VARINT_SIZES) {
+      return detail::varintSize(size);
+    } else {
+      return sizeof(std::size_t);
+    }
+  }
+
+  [[nodiscard]] constexpr auto packVarint(std::uint64_t value) -> bool {
+    auto bytes = std::array<std::byte, detail::MAX_VARINT_SIZE>{};
+    const auto len = detail::encodeVarint(value, bytes);
+    return stream_.write(std::span{ bytes }.first(len));
+  }
+
   template <PrimitiveValueType T>
   [[nodiscard]] constexpr auto pack(std::span<const T> data) -> bool {
+    if constexpr (detail::VarintInteger<T, Encoding>) {
+      auto written = 0UZ;
+      for (const auto& value : data) {
+        auto raw = std::uint64_t{};
+        if constexpr (std::signed_integral<T>) {
+          raw = detail::zigzagEncode(value);
+        } else {
+          raw = value;
+        }
+        if (not packVarint(raw)) {
+          stream_.rewind(written);  // undo encoding preceding elements
+          return false;
+        }
+        written += detail::varintSize(raw);
+      }
+      return true;
+    } else {
+      return write(data);
+    }
+  }
+
+  template <PrimitiveValueType T>
+  [[nodiscard]] constexpr auto write(std::span<const T> data) -> bool {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
     return stream_.write({ reinterpret_cast<const std::byte*>(data.data()), data.size_bytes() });
   }
@@ -127,7 +497,9 @@ private:
 
 //=================================================================================================
 /// Deserialises data encoded with Serialiser class
-template <ReadableStream Stream>
+/// @tparam Stream Readable stream buffer
+/// @tparam Encoding Wire encoding policy the data was encoded with
+template <ReadableStream Stream, EncodingPolicy Encoding = FixedEncoding>
 class Deserialiser {
 public:
   /// Initialise
@@ -135,14 +507,17 @@ public:
   explicit constexpr Deserialiser(Stream& stream) : stream_(stream) {
   }
 
+  // Note on decoding into containers: Existing capacity of strings and vectors is reused, so
+  // repeatedly decoding into the same object does not allocate once it has grown large enough.
+
   [[nodiscard]] constexpr auto unpack(std::string& str) -> bool {
     std::size_t sz{};
-    if (not unpack(sz)) {
+    if (not unpackCount(sz, detail::minSize<char, Encoding>())) {
       return false;
     }
     str.resize(sz);
     if (not unpack(std::span<char>{ str.data(), sz })) {
-      stream_.rewind(sizeof(std::size_t));  // undo decoding size
+      stream_.rewind(encodedSizeOfSize(sz));  // undo decoding size
       return false;
     }
     return true;
@@ -188,12 +563,12 @@ public:
   template <PrimitiveValueType T>
   [[nodiscard]] constexpr auto unpack(std::vector<T>& data) -> bool {
     std::size_t sz{};
-    if (not unpack(sz)) {
+    if (not unpackCount(sz, detail::minSize<T, Encoding>())) {
       return false;
     }
     data.resize(sz);
     if (not unpack(std::span<T>{ data.data(), sz })) {
-      stream_.rewind(sizeof(std::size_t));  // undo decoding size
+      stream_.rewind(encodedSizeOfSize(sz));  // undo decoding size
       return false;
     }
     return true;
@@ -204,10 +579,139 @@ public:
     return unpack(std::span<T>{ data.data(), data.size() });
   }
 
+  template <typename T>
+  [[nodiscard]] constexpr auto unpack(std::vector<T>& data) -> bool {
+    const auto start = stream_.remaining().size();
+    std::size_t sz{};
+    if (not unpackCount(sz, detail::minSize<T, Encoding>())) {
+      return false;
+    }
+    data.resize(sz);
+    if (not unpackElements(std::span<T>{ data.data(), sz })) {
+      stream_.rewind(start - stream_.remaining().size());  // undo decoding size and elements
+      return false;
+    }
+    return true;
+  }
+
+  template <typename T, std::size_t N>
+    requires(not PrimitiveValueType<T>)
+  [[nodiscard]] constexpr auto unpack(std::array<T, N>& data) -> bool {
+    return unpackElements(std::span<T>{ data.data(), data.size() });
+  }
+
+  template <detail::SequenceContainer C>
+  [[nodiscard]] constexpr auto unpack(C& data) -> bool {
+    const auto start = stream_.remaining().size();
+    std::size_t sz{};
+    if (not unpackCount(sz, detail::minSize<typename C::value_type, Encoding>())) {
+      return false;
+    }
+    data.clear();
+    if constexpr (requires { data.reserve(sz); }) {
+      data.reserve(sz);
+    }
+    for (auto i = 0UZ; i < sz; ++i) {
+      auto element = typename C::value_type{};
+      if (not this->unpack(element)) {
+        stream_.rewind(start - stream_.remaining().size());  // undo decoding size and elements
+        return false;
+      }
+      data.emplace_back(std::move(element));
+    }
+    return true;
+  }
+
+  template <detail::AssociativeContainer C>
+  [[nodiscard]] constexpr auto unpack(C& data) -> bool {
+    constexpr auto MIN_ELEMENT_SIZE = [] {
+      if constexpr (detail::MapContainer<C>) {
+        return detail::minSize<typename C::key_type, Encoding>() +
+               detail::minSize<typename C::mapped_type, Encoding>();
+      } else {
+        return detail::minSize<typename C::key_type, Encoding>();
+      }
+    }();
+    const auto start = stream_.remaining().size();
+    const auto undo = [this, start] { stream_.rewind(start - stream_.remaining().size()); };
+    std::size_t sz{};
+    if (not unpackCount(sz, MIN_ELEMENT_SIZE)) {
+      return false;
+    }
+    data.clear();
+    if constexpr (requires { data.reserve(sz); }) {
+      data.reserve(sz);
+    }
+    for (auto i = 0UZ; i < sz; ++i) {
+      auto key = typename C::key_type{};
+      if (not this->unpack(key)) {
+        undo();  // undo decoding size and preceding elements
+        return false;
+      }
+      if constexpr (detail::MapContainer<C>) {
+        auto mapped = typename C::mapped_type{};
+        if (not this->unpack(mapped)) {
+          undo();
+          return false;
+        }
+        data.emplace_hint(data.end(), std::move(key), std::move(mapped));
+      } else {
+        data.emplace_hint(data.end(), std::move(key));
+      }
+    }
+    return true;
+  }
+
+  template <typename First, typename Second>
+  [[nodiscard]] constexpr auto unpack(std::pair<First, Second>& value) -> bool {
+    return this->unpack(value.first) && this->unpack(value.second);
+  }
+
+  /// Storage of a value already held is reused
+  template <typename T>
+  [[nodiscard]] constexpr auto unpack(std::optional<T>& value) -> bool {
+    auto has_value = false;
+    if (not this->unpack(has_value)) {
+      return false;
+    }
+    if (not has_value) {
+      value.reset();
+      return true;
+    }
+    if (not value.has_value()) {
+      value.emplace();
+    }
+    if (not this->unpack(*value)) {
+      stream_.rewind(sizeof(bool));  // undo decoding presence
+      return false;
+    }
+    return true;
+  }
+
+  template <typename T>
+  [[nodiscard]] constexpr auto unpack(Columns<T>& data) -> bool {
+    const auto start = stream_.remaining().size();
+    std::size_t sz{};
+    if (not unpackCount(sz, detail::minSize<T, Encoding>())) {
+      return false;
+    }
+    data.resize(sz);
+    auto rows = std::array<T, detail::COLUMN_CHUNK_SIZE<T>>{};
+    for (auto first = 0UZ; first < sz; first += rows.size()) {
+      const auto chunk = std::span{ rows }.first(std::min(rows.size(), sz - first));
+      if (not unpackElements(chunk)) {
+        stream_.rewind(start - stream_.remaining().size());  // undo decoding size and elements
+        return false;
+      }
+      data.scatter(first, chunk);
+    }
+    return true;
+  }
+
   template <typename... Types>
   [[nodiscard]] constexpr auto unpack(std::variant<Types...>& value) -> bool {
     std::size_t idx{};
-    if (not this->unpack(idx)) {
+    if (not unpackSize(idx)) {
       return false;
     }
 
@@ -223,6 +727,9 @@ public:
         []<std::size_t... Is>(std::index_sequence<Is...>) constexpr {
           return std::array<UnpackFn, sizeof...(Types)>{ []<std::size_t I>() constexpr -> UnpackFn {
             return [](Deserialiser* self, VariantType* var) -> bool {
+              if (var->index() == I) {
+                return self->unpack(std::get<I>(*var));  // reuse storage of held alternative
+              }
               using T = std::variant_alternative_t<I, VariantType>;
               T val{};
               if (self->unpack(val)) {
@@ -237,7 +744,7 @@ public:
     // unpack the type at index idx in the variant
     // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
     if (not DISPATCH_TABLE.at(idx)(this, &value)) {
-      stream_.rewind(sizeof(std::size_t));
+      stream_.rewind(encodedSizeOfSize(idx));
       return false;
     }
 
@@ -247,12 +754,128 @@ public:
   template <typename T>
     requires detail::SerializableAggregate<T&>
   [[nodiscard]] constexpr auto unpack(T& value) -> bool {
+    if constexpr (detail::BulkCopyable<T> && not Encoding::VARINT_INTEGERS) {
+      if !consteval {
+        return stream_.read(std::as_writable_bytes(std::span{ &value, 1U }));
+      }
+    }
     return detail::processMembers(value, [this](auto& field) { return this->unpack(field); });
   }
 
 private:
+  /// Decodes a sequence of elements, in a single read if their layout allows
+  template <typename T>
+  [[nodiscard]] constexpr auto unpackElements(std::span<T> data) -> bool {
+    if constexpr (detail::BulkCopyable<T> && not Encoding::VARINT_INTEGERS) {
+      if !consteval {
+        return stream_.read(std::as_writable_bytes(data));
+      }
+    }
+    return std::ranges::all_of(data, [this](T& value) { return this->unpack(value); });
+  }
+
+  /// Decodes size of a sequence or index of a variant
+  [[nodiscard]] constexpr auto unpackSize(std::size_t& size) -> bool {
+    if constexpr (Encoding::VARINT_SIZES) {
+      auto raw = std::uint64_t{};
+      if (not unpackVarint(raw)) {
+        return false;
+      }
+      size = raw;
+      return true;
+    } else {
+      return read(std::span<std::size_t>{ &size, 1U });
+    }
+  }
+
+  [[nodiscard]] static constexpr auto encodedSizeOfSize(std::size_t size) -> std::size_t {
+    if constexpr (Encoding::VARINT_SIZES) {
+      return detail::varintSize(size);
+    } else {
+      return sizeof(std::size_t);
+    }
+  }
+
+  /// Decodes the number of elements in a sequence. Fails, consuming nothing, if the remaining data
+  /// is too short to hold that many elements, so that a corrupt count cannot cause an allocation
+  /// out of proportion to the data
+  /// @param count Receives the number of elements
+  /// @param min_element_size Fewest bytes an element can encode into
+  [[nodiscard]] constexpr auto unpackCount(std::size_t& count, std::size_t min_element_size)
+      -> bool {
+    if (not unpackSize(count)) {
+      return false;
+    }
+    if (count > stream_.remaining().size() / std::max(1UZ, min_element_size)) {
+      stream_.rewind(encodedSizeOfSize(count));
+      return false;
+    }
+    return true;
+  }
+
+  /// Decodes an unsigned LEB128 varint. Only the shortest encoding of a 64-bit value, as written by
+  /// packVarint, is accepted, so that it takes exactly varintSize(value) bytes, on which rewinding
+  /// of partially decoded data relies. Nothing is consumed on failure
+  [[nodiscard]] constexpr auto unpackVarint(std::uint64_t& value) -> bool {
+    constexpr auto LAST = detail::MAX_VARINT_SIZE - 1U;
+    auto result = std::uint64_t{ 0 };
+    for (auto i = 0UZ; i < detail::MAX_VARINT_SIZE; ++i) {
+      auto byte = std::byte{};
+      if (not stream_.read({ &byte, 1U })) {
+        stream_.rewind(i);
+        return false;
+      }
+      const auto bits = std::to_integer<std::uint64_t>(byte);
+      const auto is_padded = (i > 0U) && (bits == 0U);  // trailing zeros add nothing to the value
+      const auto is_overflow = (i == LAST) && (bits > 1U);  // only bit 63 is left for the last byte
+      if (is_padded || is_overflow) {
+        stream_.rewind(i + 1U);
+        return false;
+      }
+      result |= (bits & detail::VARINT_PAYLOAD_MASK) << (i * detail::VARINT_PAYLOAD_BITS);
+      if ((bits & detail::VARINT_CONTINUATION_BIT) == 0U) {
+        value = result;
+        return true;
+      }
+    }
+    stream_.rewind(detail::MAX_VARINT_SIZE);  // too long to be a 64-bit value
+    return false;
+  }
+
   template <PrimitiveValueType T>
   [[nodiscard]] constexpr auto unpack(std::span<T> data) -> bool {
+    if constexpr (detail::VarintInteger<T, Encoding>) {
+      auto consumed = 0UZ;
+      for (auto& value : data) {
+        auto raw = std::uint64_t{};
+        if (not unpackVarint(raw)) {
+          stream_.rewind(consumed);  // undo decoding preceding elements
+          return false;
+        }
+        consumed += detail::varintSize(raw);
+        if constexpr (std::signed_integral<T>) {
+          const auto decoded = detail::zigzagDecode(raw);
+          if (not std::in_range<T>(decoded)) {
+            stream_.rewind(consumed);
+            return false;
+          }
+          value = static_cast<T>(decoded);
+        } else {
+          if (not std::in_range<T>(raw)) {
+            stream_.rewind(consumed);
+            return false;
+          }
+          value = static_cast<T>(raw);
+        }
+      }
+      return true;
+    } else {
+      return read(data);
+    }
+  }
+
+  template <PrimitiveValueType T>
+  [[nodiscard]] constexpr auto read(std::span<T> data) -> bool {
     // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
     return stream_.read({ reinterpret_cast<std::byte*>(data.data()), data.size_bytes() });
   }
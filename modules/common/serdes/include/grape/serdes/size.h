@@ -0,0 +1,274 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "grape/serdes/encoding.h"
+#include "grape/serdes/serdes.h"
+
+namespace grape::serdes {
+
+namespace detail {
+
+//=================================================================================================
+/// Computes the number of bytes Serialiser<Stream, Encoding> writes for a value, without encoding
+/// it. Mirrors the overloads of Serialiser one for one; keep the two in sync.
+template <EncodingPolicy Encoding>
+class SizeCalculator {
+public:
+  [[nodiscard]] static constexpr auto sizeOf(const std::string& value) -> std::size_t {
+    return sizeOfSize(value.size()) + value.size();
+  }
+
+  template <PrimitiveValueType T>
+  [[nodiscard]] static constexpr auto sizeOf(const T& value) -> std::size_t {
+    if constexpr (VarintInteger<T, Encoding>) {
+      if constexpr (std::signed_integral<T>) {
+        return varintSize(zigzagEncode(value));
+      } else {
+        return varintSize(value);
+      }
+    } else {
+      return sizeof(T);
+    }
+  }
+
+  template <typename T>
+    requires std::is_enum_v<T>
+  [[nodiscard]] static constexpr auto sizeOf(const T& value) -> std::size_t {
+    return sizeOf(static_cast<std::underlying_type_t<T>>(value));
+  }
+
+  template <typename Rep, typename Period>
+  [[nodiscard]] static constexpr auto sizeOf(const std::chrono::duration<Rep, Period>& value)
+      -> std::size_t {
+    return sizeOf(value.count());
+  }
+
+  template <typename Clock, typename Duration>
+  [[nodiscard]] static constexpr auto sizeOf(const std::chrono::time_point<Clock, Duration>& value)
+      -> std::size_t {
+    return sizeOf(value.time_since_epoch());
+  }
+
+  template <typename T>
+  [[nodiscard]] static constexpr auto sizeOf(const std::vector<T>& data) -> std::size_t {
+    return sizeOfSize(data.size()) + sizeOfElements(std::span<const T>{ data.data(), data.size() });
+  }
+
+  template <typename T, std::size_t N>
+  [[nodiscard]] static constexpr auto sizeOf(const std::array<T, N>& data) -> std::size_t {
+    return sizeOfElements(std::span<const T>{ data.data(), data.size() });
+  }
+
+  template <typename C>
+    requires SequenceContainer<C> || AssociativeContainer<C>
+  [[nodiscard]] static constexpr auto sizeOf(const C& data) -> std::size_t {
+    auto total = sizeOfSize(std::ranges::size(data));
+    for (const auto& element : data) {
+      total += sizeOf(element);
+    }
+    return total;
+  }
+
+  template <typename T>
+  [[nodiscard]] static constexpr auto sizeOf(const Columns<T>& data) -> std::size_t {
+    if constexpr (not Encoding::VARINT_INTEGERS) {
+      return sizeOfSize(data.size()) + (data.size() * sizeof(T));
+    } else {
+      auto total = sizeOfSize(data.size());
+      auto rows = std::array<T, COLUMN_CHUNK_SIZE<T>>{};
+      for (auto first = 0UZ; first < data.size(); first += rows.size()) {
+        const auto chunk = std::span{ rows }.first(std::min(rows.size(), data.size() - first));
+        data.gather(first, chunk);
+        total += sizeOfElements(std::span<const T>{ chunk });
+      }
+      return total;
+    }
+  }
+
+  template <typename First, typename Second>
+  [[nodiscard]] static constexpr auto sizeOf(const std::pair<First, Second>& value)
+      -> std::size_t {
+    return sizeOf(value.first) + sizeOf(value.second);
+  }
+
+  template <typename T>
+  [[nodiscard]] static constexpr auto sizeOf(const std::optional<T>& value) -> std::size_t {
+    return sizeof(bool) + (value.has_value() ? sizeOf(*value) : 0U);
+  }
+
+  template <typename... Types>
+  [[nodiscard]] static constexpr auto sizeOf(const std::variant<Types...>& value) -> std::size_t {
+    return sizeOfSize(value.index()) +
+           std::visit([](const auto& val) { return sizeOf(val); }, value);
+  }
+
+  template <typename T>
+    requires SerializableAggregate<const T&>
+  [[nodiscard]] static constexpr auto sizeOf(const T& value) -> std::size_t {
+    if constexpr (BulkCopyable<T> && not Encoding::VARINT_INTEGERS) {
+      return sizeof(T);
+    } else {
+      auto total = 0UZ;
+      std::ignore = processMembers(value, [&total](const auto& field) {
+        total += sizeOf(field);
+        return true;
+      });
+      return total;
+    }
+  }
+
+  /// @return Size of an encoded sequence size or variant index
+  [[nodiscard]] static constexpr auto sizeOfSize(std::size_t size) -> std::size_t {
+    if constexpr (Encoding::VARINT_SIZES) {
+      return varintSize(size);
+    } else {
+      return sizeof(std::size_t);
+    }
+  }
+
+private:
+  template <typename T>
+  [[nodiscard]] static constexpr auto sizeOfElements(std::span<const T> data) -> std::size_t {
+    if constexpr ((PrimitiveValueType<T> && not VarintInteger<T, Encoding>) ||
+                  (BulkCopyable<T> && not Encoding::VARINT_INTEGERS)) {
+      return data.size() * sizeof(T);
+    } else {
+      auto total = 0UZ;
+      for (const auto& element : data) {
+        total += sizeOf(element);
+      }
+      return total;
+    }
+  }
+};
+
+template <typename T>
+struct IsStdOptional : std::false_type {};
+
+template <typename T>
+struct IsStdOptional<std::optional<T>> : std::true_type {};
+
+template <typename T>
+struct IsStdVariant : std::false_type {};
+
+template <typename... Types>
+struct IsStdVariant<std::variant<Types...>> : std::true_type {};
+
+template <typename T>
+struct IsStdPair : std::false_type {};
+
+template <typename First, typename Second>
+struct IsStdPair<std::pair<First, Second>> : std::true_type {};
+
+template <typename T>
+struct IsChrono : std::false_type {};
+
+template <typename Rep, typename Period>
+struct IsChrono<std::chrono::duration<Rep, Period>> : std::true_type {};
+
+template <typename Clock, typename Duration>
+struct IsChrono<std::chrono::time_point<Clock, Duration>> : std::true_type {};
+
+/// Largest number of bytes a value of type T can encode into, if that does not depend on the
+/// number of elements in a container. Empty otherwise.
+template <typename T, EncodingPolicy Encoding>
+consteval auto maxSize() -> std::optional<std::size_t> {
+  if constexpr (PrimitiveValueType<T>) {
+    if constexpr (VarintInteger<T, Encoding>) {
+      return varintSize(std::numeric_limits<std::uint64_t>::max() >>
+                        (std::numeric_limits<std::uint64_t>::digits -
+                         std::numeric_limits<std::make_unsigned_t<T>>::digits));
+    } else {
+      return sizeof(T);
+    }
+  } else if constexpr (std::is_enum_v<T>) {
+    return maxSize<std::underlying_type_t<T>, Encoding>();
+  } else if constexpr (IsChrono<T>::value) {
+    return maxSize<typename T::rep, Encoding>();
+  } else if constexpr (IsStdArray<T>::value) {
+    const auto element = maxSize<typename T::value_type, Encoding>();
+    return element.transform([](auto size) { return size * std::tuple_size_v<T>; });
+  } else if constexpr (IsStdPair<T>::value) {
+    const auto first = maxSize<typename T::first_type, Encoding>();
+    const auto second = maxSize<typename T::second_type, Encoding>();
+    return (first && second) ? std::optional{ *first + *second } : std::nullopt;
+  } else if constexpr (IsStdOptional<T>::value) {
+    const auto value = maxSize<typename T::value_type, Encoding>();
+    return value.transform([](auto size) { return sizeof(bool) + size; });
+  } else if constexpr (IsStdVariant<T>::value) {
+    return []<std::size_t... Is>(std::index_sequence<Is...>) -> std::optional<std::size_t> {
+      const auto sizes = std::array{ maxSize<std::variant_alternative_t<Is, T>, Encoding>()... };
+      if (not std::ranges::all_of(sizes, [](const auto& size) { return size.has_value(); })) {
+        return std::nullopt;
+      }
+      auto largest = 0UZ;
+      for (const auto& size : sizes) {
+        largest = std::max(largest, *size);
+      }
+      return SizeCalculator<Encoding>::sizeOfSize(sizeof...(Is) - 1U) + largest;
+    }(std::make_index_sequence<std::variant_size_v<T>>{});
+  } else if constexpr (SerializableAggregate<T&>) {
+    return []<std::size_t... Is>(std::index_sequence<Is...>) -> std::optional<std::size_t> {
+      const auto sizes = std::array<std::optional<std::size_t>, sizeof...(Is)>{
+        maxSize<FieldType<T, Is>, Encoding>()...
+      };
+      auto total = 0UZ;
+      for (const auto& size : sizes) {
+        if (not size.has_value()) {
+          return std::nullopt;
+        }
+        total += *size;
+      }
+      return total;
+    }(std::make_index_sequence<FIELD_COUNT<T>>{});
+  } else {
+    return std::nullopt;  // strings and containers
+  }
+}
+
+}  // namespace detail
+
+//-------------------------------------------------------------------------------------------------
+/// Types for which maxSerialisedSize() is defined: those without strings or containers other than
+/// std::array anywhere in their structure
+template <typename T, typename Encoding = FixedEncoding>
+concept BoundedSerialisedSize = EncodingPolicy<Encoding> &&
+                                detail::maxSize<std::remove_cvref_t<T>, Encoding>().has_value();
+
+//-------------------------------------------------------------------------------------------------
+/// Computes the exact number of bytes Serialiser writes for value, without encoding it. Sizes of
+/// strings and of containers of fixed-size elements are computed without visiting their contents.
+/// @tparam Encoding Encoding policy of the Serialiser
+/// @note Columns must be of the same size, as required for serialisation
+template <EncodingPolicy Encoding = FixedEncoding, typename T>
+[[nodiscard]] constexpr auto serialisedSize(const T& value) -> std::size_t {
+  return detail::SizeCalculator<Encoding>::sizeOf(value);
+}
+
+//-------------------------------------------------------------------------------------------------
+/// @return Largest number of bytes Serialiser can write for a value of type T. For types that
+/// contain neither optionals, variants nor (with CompactIntegerEncoding) integers, every value
+/// encodes into exactly this many bytes.
+template <typename T, EncodingPolicy Encoding = FixedEncoding>
+  requires BoundedSerialisedSize<T, Encoding>
+[[nodiscard]] consteval auto maxSerialisedSize() -> std::size_t {
+  return *detail::maxSize<std::remove_cvref_t<T>, Encoding>();
+}
+
+}  // namespace grape::serdes
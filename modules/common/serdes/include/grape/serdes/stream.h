@@ -6,7 +6,10 @@
 
 #include <algorithm>  // std::copy_n
 #include <array>
+#include <memory_resource>
+#include <new>
 #include <span>
+#include <utility>
 
 #include "grape/serdes/concepts.h"
 
@@ -67,6 +70,211 @@ private:
   std::array<std::byte, MAX_SIZE> buf_{};
 };
 
+//=================================================================================================
+/// A writable stream over a fixed-size buffer owned by the caller. Used to serialise directly into
+/// memory managed elsewhere (e.g. buffers of a transport layer) instead of into an OutStream
+class SpanOutStream {
+public:
+  /// Initialise
+  /// @param buffer Memory to encode data into
+  explicit constexpr SpanOutStream(std::span<std::byte> buffer) : buf_(buffer) {
+  }
+
+  /// @brief Write data into stream buffer
+  /// @param data data span to write
+  /// @return true on success. false if buffer doesn't have enough space. Nothing is written if so.
+  [[nodiscard]] constexpr auto write(std::span<const std::byte> data) -> bool {
+    const auto len = data.size_bytes();
+    if (offset_ + len > buf_.size_bytes()) {
+      return false;
+    }
+    std::ranges::copy(data, buf_.subspan(offset_, len).begin());
+    offset_ += len;
+    return true;
+  }
+
+  /// @return Immutable pointer to the bytes written so far
+  [[nodiscard]] constexpr auto data() const -> std::span<const std::byte> {
+    return buf_.first(offset_);
+  }
+
+  /// @return Number of bytes written so far in the stream buffer
+  [[nodiscard]] constexpr auto size() const -> std::size_t {
+    return offset_;
+  }
+
+  /// @return maximum number of bytes the stream buffer can hold
+  [[nodiscard]] constexpr auto capacity() const -> std::size_t {
+    return buf_.size_bytes();
+  }
+
+  /// Set next writing position to 'n' bytes behind the current positon
+  constexpr void rewind(std::size_t n) {
+    offset_ = (n < offset_) ? (offset_ - n) : 0U;
+  }
+
+  /// Reset next writing position to the beginning of the stream buffer
+  constexpr void reset() {
+    offset_ = 0U;
+  }
+
+private:
+  std::size_t offset_{ 0 };
+  std::span<std::byte> buf_;
+};
+
+//=================================================================================================
+/// A writable stream over a buffer that grows as needed. The buffer is allocated from a memory
+/// resource provided by the caller, such as a std::pmr::monotonic_buffer_resource over an arena,
+/// and grows geometrically so that the cost of copying on growth is amortised. Capacity is kept
+/// on reset(), so a stream reused for every message stops allocating once it has grown to the
+/// largest message. Give the memory resource a std::pmr::null_memory_resource() upstream to put an
+/// upper bound on growth.
+class ArenaOutStream {
+public:
+  static constexpr auto DEFAULT_INITIAL_CAPACITY = 256UZ;
+  static constexpr auto GROWTH_FACTOR = 2UZ;
+
+  /// Initialise
+  /// @param initial_capacity Number of bytes to allocate upfront
+  /// @param resource Memory resource to allocate the buffer from. Must outlive the stream
+  explicit ArenaOutStream(std::size_t initial_capacity = DEFAULT_INITIAL_CAPACITY,
+                          std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+    : resource_(resource) {
+    if (not reserve(initial_capacity)) {
+      throw std::bad_alloc{};
+    }
+  }
+
+  ~ArenaOutStream() {
+    release();
+  }
+
+  ArenaOutStream(const ArenaOutStream&) = delete;
+  auto operator=(const ArenaOutStream&) -> ArenaOutStream& = delete;
+
+  ArenaOutStream(ArenaOutStream&& other) noexcept
+    : resource_(other.resource_)
+    , offset_(std::exchange(other.offset_, 0U))
+    , buf_(std::exchange(other.buf_, {})) {
+  }
+
+  auto operator=(ArenaOutStream&& other) noexcept -> ArenaOutStream& {
+    if (this != &other) {
+      release();
+      resource_ = other.resource_;
+      offset_ = std::exchange(other.offset_, 0U);
+      buf_ = std::exchange(other.buf_, {});
+    }
+    return *this;
+  }
+
+  /// @brief Write data into stream buffer, growing it if required
+  /// @param data data span to write
+  /// @return true on success. false if the memory resource could not provide a larger buffer.
+  /// Nothing is written if so.
+  [[nodiscard]] auto write(std::span<const std::byte> data) -> bool {
+    const auto len = data.size_bytes();
+    if ((offset_ + len > buf_.size_bytes()) and
+        (not reserve(std::max(offset_ + len, GROWTH_FACTOR * buf_.size_bytes())))) {
+      return false;
+    }
+    std::ranges::copy(data, buf_.subspan(offset_, len).begin());
+    offset_ += len;
+    return true;
+  }
+
+  /// Grow the buffer to hold at least 'n' bytes. Bytes written so far are preserved.
+  /// @return true on success, false if the memory resource could not provide the memory
+  [[nodiscard]] auto reserve(std::size_t n) -> bool {
+    if (n <= buf_.size_bytes()) {
+      return true;
+    }
+    try {
+      auto* mem = static_cast<std::byte*>(resource_->allocate(n, alignof(std::max_align_t)));
+      std::ranges::copy(buf_.first(offset_), mem);
+      release();
+      buf_ = { mem, n };
+      return true;
+    } catch (const std::bad_alloc&) {
+      return false;
+    }
+  }
+
+  /// @return Pointer to the stream buffer
+  [[nodiscard]] auto data() -> std::span<std::byte> {
+    return buf_.first(offset_);
+  }
+
+  /// @return Immutable pointer to the stream buffer
+  [[nodiscard]] auto data() const -> std::span<const std::byte> {
+    return buf_.first(offset_);
+  }
+
+  /// @return Number of bytes written so far in the stream buffer
+  [[nodiscard]] auto size() const -> std::size_t {
+    return offset_;
+  }
+
+  /// @return Number of bytes the stream buffer can hold before it needs to grow
+  [[nodiscard]] auto capacity() const -> std::size_t {
+    return buf_.size_bytes();
+  }
+
+  /// Set next writing position to 'n' bytes behind the current positon
+  void rewind(std::size_t n) {
+    offset_ = (n < offset_) ? (offset_ - n) : 0U;
+  }
+
+  /// Reset next writing position to the beginning of the stream buffer. Capacity is retained.
+  void reset() {
+    offset_ = 0U;
+  }
+
+private:
+  void release() {
+    if (buf_.data() != nullptr) {
+      resource_->deallocate(buf_.data(), buf_.size_bytes(), alignof(std::max_align_t));
+    }
+    buf_ = {};
+  }
+
+  std::pmr::memory_resource* resource_;
+  std::size_t offset_{ 0 };
+  std::span<std::byte> buf_;
+};
+
+//=================================================================================================
+/// A writable stream that discards data and only counts the bytes written to it. Used to find the
+/// encoded size of data before encoding it.
+class CountingStream {
+public:
+  /// @brief Count bytes without storing them
+  /// @return true always
+  [[nodiscard]] constexpr auto write(std::span<const std::byte> data) -> bool {
+    offset_ += data.size_bytes();
+    return true;
+  }
+
+  /// @return Number of bytes written so far
+  [[nodiscard]] constexpr auto size() const -> std::size_t {
+    return offset_;
+  }
+
+  /// Set next writing position to 'n' bytes behind the current positon
+  constexpr void rewind(std::size_t n) {
+    offset_ = (n < offset_) ? (offset_ - n) : 0U;
+  }
+
+  /// Reset count to zero
+  constexpr void reset() {
+    offset_ = 0U;
+  }
+
+private:
+  std::size_t offset_{ 0 };
+};
+
 //=================================================================================================
 /// A generic interface to a readable fixed-size data stream
 class InStream {
@@ -91,6 +299,23 @@ public:
     return true;
   }
 
+  /// Advances reading position without copying data out of the stream
+  /// @param n Number of bytes to skip over
+  /// @return true on success, false if stream doesn't contain 'n' more bytes. Nothing is skipped
+  /// if so.
+  [[nodiscard]] constexpr auto skip(std::size_t n) -> bool {
+    if (n > stream_.size() - offset_) {
+      return false;
+    }
+    offset_ += n;
+    return true;
+  }
+
+  /// @return Bytes not yet read from the stream, viewed in place
+  [[nodiscard]] constexpr auto remaining() const -> std::span<const std::byte> {
+    return stream_.subspan(offset_);
+  }
+
   /// @return Number of bytes in the stream buffer
   [[nodiscard]] constexpr auto size() const -> std::size_t {
     return stream_.size_bytes();
@@ -112,6 +337,9 @@ private:
 };
 
 static_assert(WritableStream<OutStream<1>>);
+static_assert(WritableStream<SpanOutStream>);
+static_assert(WritableStream<ArenaOutStream>);
+static_assert(WritableStream<CountingStream>);
 static_assert(ReadableStream<InStream>);
 
 }  // namespace grape::serdes
@@ -0,0 +1,281 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "grape/serdes/serdes.h"
+#include "grape/serdes/stream.h"
+
+namespace grape::serdes {
+
+//=================================================================================================
+/// Read-only view over a contiguous sequence of primitive values encoded by Serialiser. Elements
+/// are read in place on access. The encoded bytes carry no alignment guarantee, so elements are
+/// returned by value rather than by reference.
+template <PrimitiveValueType T>
+class ArrayView {
+public:
+  constexpr ArrayView() = default;
+
+  /// @param bytes Encoded elements. Trailing bytes short of a whole element are ignored
+  explicit constexpr ArrayView(std::span<const std::byte> bytes)
+    : bytes_(bytes.first(bytes.size() - (bytes.size() % sizeof(T)))) {
+  }
+
+  /// @return Number of elements
+  [[nodiscard]] constexpr auto size() const -> std::size_t {
+    return bytes_.size() / sizeof(T);
+  }
+
+  [[nodiscard]] constexpr auto empty() const -> bool {
+    return bytes_.empty();
+  }
+
+  /// @return Element at index idx. No bounds checking is performed
+  [[nodiscard]] constexpr auto operator[](std::size_t idx) const -> T {
+    auto raw = std::array<std::byte, sizeof(T)>{};
+    std::ranges::copy(bytes_.subspan(idx * sizeof(T), sizeof(T)), raw.begin());
+    return std::bit_cast<T>(raw);
+  }
+
+  /// @return The encoded elements, viewed in place
+  [[nodiscard]] constexpr auto bytes() const -> std::span<const std::byte> {
+    return bytes_;
+  }
+
+private:
+  std::span<const std::byte> bytes_;
+};
+
+template <typename T>
+  requires detail::SerializableAggregate<T&>
+class View;
+
+namespace detail {
+
+//-------------------------------------------------------------------------------------------------
+/// Defines how a field of type T is stepped over in an encoded stream, and how it is presented
+/// when accessed through a View. By default, fields are decoded into a value on access.
+template <typename T>
+struct FieldViewer {
+  using Type = T;
+
+  [[nodiscard]] static constexpr auto skip(InStream& stream) -> bool {
+    auto value = T{};
+    return Deserialiser<InStream>(stream).unpack(value);
+  }
+
+  [[nodiscard]] static constexpr auto view(std::span<const std::byte> bytes) -> Type {
+    auto stream = InStream(bytes);
+    auto value = T{};
+    std::ignore = Deserialiser<InStream>(stream).unpack(value);
+    return value;
+  }
+};
+
+/// Steps over a size-prefixed sequence of elements of size elem_size
+[[nodiscard]] constexpr auto skipSized(InStream& stream, std::size_t elem_size) -> bool {
+  auto count = std::size_t{};
+  if (not Deserialiser<InStream>(stream).unpack(count)) {
+    return false;
+  }
+  if (count > stream.remaining().size() / elem_size) {
+    return false;
+  }
+  return stream.skip(count * elem_size);
+}
+
+/// Strings are viewed in place
+template <>
+struct FieldViewer<std::string> {
+  using Type = std::string_view;
+
+  [[nodiscard]] static constexpr auto skip(InStream& stream) -> bool {
+    return skipSized(stream, sizeof(char));
+  }
+
+  [[nodiscard]] static auto view(std::span<const std::byte> bytes) -> Type {
+    const auto chars = bytes.subspan(sizeof(std::size_t));
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return { reinterpret_cast<const char*>(chars.data()), chars.size() };
+  }
+};
+
+/// Vectors of primitive values are viewed in place
+template <PrimitiveValueType T>
+struct FieldViewer<std::vector<T>> {
+  using Type = ArrayView<T>;
+
+  [[nodiscard]] static constexpr auto skip(InStream& stream) -> bool {
+    return skipSized(stream, sizeof(T));
+  }
+
+  [[nodiscard]] static constexpr auto view(std::span<const std::byte> bytes) -> Type {
+    return Type{ bytes.subspan(sizeof(std::size_t)) };
+  }
+};
+
+/// Arrays of primitive values are viewed in place
+template <PrimitiveValueType T, std::size_t N>
+struct FieldViewer<std::array<T, N>> {
+  using Type = ArrayView<T>;
+
+  [[nodiscard]] static constexpr auto skip(InStream& stream) -> bool {
+    return stream.skip(N * sizeof(T));
+  }
+
+  [[nodiscard]] static constexpr auto view(std::span<const std::byte> bytes) -> Type {
+    return Type{ bytes };
+  }
+};
+
+/// Variants are decoded into a value on access, but stepped over without decoding
+template <typename... Types>
+struct FieldViewer<std::variant<Types...>> {
+  using Type = std::variant<Types...>;
+
+  [[nodiscard]] static constexpr auto skip(InStream& stream) -> bool {
+    auto idx = std::size_t{};
+    if (not Deserialiser<InStream>(stream).unpack(idx)) {
+      return false;
+    }
+    return [&stream, idx]<std::size_t... Is>(std::index_sequence<Is...>) {
+      auto ok = false;
+      ((ok = ok || (idx == Is && FieldViewer<std::variant_alternative_t<Is, Type>>::skip(stream))),
+       ...);
+      return ok;
+    }(std::make_index_sequence<sizeof...(Types)>{});
+  }
+
+  [[nodiscard]] static constexpr auto view(std::span<const std::byte> bytes) -> Type {
+    auto stream = InStream(bytes);
+    auto value = Type{};
+    std::ignore = Deserialiser<InStream>(stream).unpack(value);
+    return value;
+  }
+};
+
+/// Steps over all members of aggregate T, recording where each one starts in the stream
+/// @param stream Stream positioned at the start of an encoded T
+/// @param offsets Receives offset of each member relative to the start of T, followed by the
+/// encoded size of T
+/// @return false if the stream does not hold a complete T
+template <typename T>
+  requires SerializableAggregate<T&>
+[[nodiscard]] constexpr auto scanFields(InStream& stream,
+                                        std::array<std::size_t, FIELD_COUNT<T> + 1>& offsets)
+    -> bool {
+  const auto start = stream.remaining().size();
+  return [&stream, &offsets, start]<std::size_t... Is>(std::index_sequence<Is...>) {
+    auto ok = true;
+    const auto mark = [&stream, &offsets, start](std::size_t idx) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-constant-array-index)
+      offsets[idx] = start - stream.remaining().size();
+      return true;
+    };
+    ((ok = ok && mark(Is) && FieldViewer<FieldType<T, Is>>::skip(stream)), ...);
+    return ok && mark(FIELD_COUNT<T>);
+  }(std::make_index_sequence<FIELD_COUNT<T>>{});
+}
+
+/// Nested aggregates are presented as views
+template <typename T>
+  requires SerializableAggregate<T&>
+struct FieldViewer<T> {
+  using Type = View<T>;
+
+  [[nodiscard]] static constexpr auto skip(InStream& stream) -> bool {
+    auto offsets = std::array<std::size_t, FIELD_COUNT<T> + 1>{};
+    return scanFields<T>(stream, offsets);
+  }
+
+  [[nodiscard]] static constexpr auto view(std::span<const std::byte> bytes) -> Type {
+    return View<T>::create(bytes).value_or(View<T>{});
+  }
+};
+
+}  // namespace detail
+
+//=================================================================================================
+/// Read-only view over an aggregate of type T encoded by Serialiser, for consumers that want to
+/// read data in place instead of decoding a full copy of it.
+///
+/// Creating a view walks the encoded data once to locate member boundaries without decoding them.
+/// Members are then decoded only when accessed through get<I>(), where I is the index of the
+/// member in declaration order. Access returns:
+/// - std::string_view for std::string members
+/// - ArrayView<U> for std::vector<U> and std::array<U, N> members of primitive type U
+/// - View<U> for nested aggregate members of type U
+/// - A decoded value for all other member types
+///
+/// Nothing is allocated except for members that are decoded into allocating values (e.g. variants
+/// holding strings). A view references the encoded bytes and must not outlive them.
+template <typename T>
+  requires detail::SerializableAggregate<T&>
+class View {
+public:
+  /// Number of members in T
+  static constexpr auto FIELD_COUNT = detail::FIELD_COUNT<T>;
+
+  /// Type returned on accessing member at index I
+  template <std::size_t I>
+  using FieldType = typename detail::FieldViewer<detail::FieldType<T, I>>::Type;
+
+  /// Creates a view over encoded data
+  /// @param bytes Data encoded by Serialiser. May be longer than the encoded T
+  /// @return View, or nothing if bytes do not hold a complete T
+  [[nodiscard]] static constexpr auto create(std::span<const std::byte> bytes)
+      -> std::optional<View> {
+    auto view = View{};
+    auto stream = InStream(bytes);
+    if (not detail::scanFields<T>(stream, view.offsets_)) {
+      return std::nullopt;
+    }
+    view.bytes_ = bytes.first(view.offsets_.back());
+    return view;
+  }
+
+  /// An empty view. Only useful as a placeholder to be assigned to
+  constexpr View() = default;
+
+  /// @return Member at index I, decoded on access
+  template <std::size_t I>
+    requires(I < FIELD_COUNT)
+  [[nodiscard]] constexpr auto get() const -> FieldType<I> {
+    const auto begin = std::get<I>(offsets_);
+    const auto end = std::get<I + 1>(offsets_);
+    return detail::FieldViewer<detail::FieldType<T, I>>::view(bytes_.subspan(begin, end - begin));
+  }
+
+  /// Decodes all members into a value
+  /// @param value Decoding target
+  /// @return true on success
+  [[nodiscard]] constexpr auto decode(T& value) const -> bool {
+    auto stream = InStream(bytes_);
+    return Deserialiser<InStream>(stream).unpack(value);
+  }
+
+  /// @return Encoded bytes viewed by this object
+  [[nodiscard]] constexpr auto bytes() const -> std::span<const std::byte> {
+    return bytes_;
+  }
+
+private:
+  std::span<const std::byte> bytes_;
+  std::array<std::size_t, FIELD_COUNT + 1> offsets_{};
+};
+
+}  // namespace grape::serdes
@@ -0,0 +1,115 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <map>
+#include <optional>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+#include "grape/serdes/schema.h"
+
+namespace {
+
+using grape::serdes::schemaHash;
+
+//-------------------------------------------------------------------------------------------------
+struct Pose {
+  double x{};
+  double y{};
+  double yaw{};
+};
+
+//-------------------------------------------------------------------------------------------------
+struct Location {  // same structure as Pose, with different names
+  double lat{};
+  double lon{};
+  double heading{};
+};
+
+//-------------------------------------------------------------------------------------------------
+struct Pose2 {  // a member fewer than Pose
+  double x{};
+  double y{};
+};
+
+//-------------------------------------------------------------------------------------------------
+struct PoseF {  // members of different precision than Pose
+  float x{};
+  float y{};
+  float yaw{};
+};
+
+//-------------------------------------------------------------------------------------------------
+struct Waypoint {
+  std::string name;
+  Pose pose;
+  std::vector<std::uint16_t> tags;
+  std::variant<std::int32_t, std::string> note;
+  std::chrono::milliseconds dwell{};
+};
+
+//-------------------------------------------------------------------------------------------------
+struct WaypointReordered {  // same members as Waypoint in a different order
+  Pose pose;
+  std::string name;
+  std::vector<std::uint16_t> tags;
+  std::variant<std::int32_t, std::string> note;
+  std::chrono::milliseconds dwell{};
+};
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Schema hash is available at compile time", "[schema]") {
+  constexpr auto HASH = schemaHash<Waypoint>();
+  STATIC_REQUIRE(HASH != 0U);
+  STATIC_REQUIRE(HASH == schemaHash<const Waypoint&>());
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Schema hash depends on structure and not on names", "[schema]") {
+  STATIC_REQUIRE(schemaHash<Pose>() == schemaHash<Location>());
+  STATIC_REQUIRE(schemaHash<Pose>() != schemaHash<Pose2>());
+  STATIC_REQUIRE(schemaHash<Pose>() != schemaHash<PoseF>());
+  STATIC_REQUIRE(schemaHash<Waypoint>() != schemaHash<WaypointReordered>());
+  STATIC_REQUIRE(schemaHash<grape::serdes::Columns<Pose>>() == schemaHash<std::vector<Pose>>());
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Schema hash distinguishes type kinds", "[schema]") {
+  STATIC_REQUIRE(schemaHash<std::int32_t>() != schemaHash<std::uint32_t>());
+  STATIC_REQUIRE(schemaHash<std::int32_t>() != schemaHash<float>());
+  STATIC_REQUIRE(schemaHash<std::int32_t>() != schemaHash<std::int64_t>());
+  STATIC_REQUIRE(schemaHash<std::vector<float>>() != schemaHash<std::array<float, 3>>());
+  STATIC_REQUIRE(schemaHash<std::array<float, 3>>() != schemaHash<std::array<float, 4>>());
+  STATIC_REQUIRE(schemaHash<std::variant<int, float>>() != schemaHash<std::variant<float, int>>());
+  STATIC_REQUIRE(schemaHash<std::chrono::milliseconds>() !=
+                 schemaHash<std::chrono::microseconds>());
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Schema hash of containers follows their encoding", "[schema]") {
+  STATIC_REQUIRE(schemaHash<std::deque<Pose>>() == schemaHash<std::vector<Pose>>());
+  STATIC_REQUIRE(schemaHash<std::list<std::string>>() == schemaHash<std::vector<std::string>>());
+  STATIC_REQUIRE(schemaHash<std::map<int, float>>() ==
+                 schemaHash<std::unordered_map<int, float>>());
+  STATIC_REQUIRE(schemaHash<std::set<int>>() == schemaHash<std::unordered_set<int>>());
+  STATIC_REQUIRE(schemaHash<std::map<int, float>>() != schemaHash<std::map<float, int>>());
+  STATIC_REQUIRE(schemaHash<std::map<int, float>>() !=
+                 schemaHash<std::vector<std::pair<int, float>>>());
+  STATIC_REQUIRE(schemaHash<std::set<int>>() != schemaHash<std::vector<int>>());
+  STATIC_REQUIRE(schemaHash<std::optional<int>>() != schemaHash<int>());
+  STATIC_REQUIRE(schemaHash<std::optional<int>>() != schemaHash<std::optional<float>>());
+}
+
+}  // namespace
@@ -2,11 +2,55 @@
 // Copyright (C) 2024 GRAPE Contributors
 //=================================================================================================
 
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <limits>
+#include <list>
+#include <map>
+#include <new>
+#include <optional>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <variant>
+#include <vector>
+
 #include "catch2/catch_test_macros.hpp"
 #include "catch2/matchers/catch_matchers_floating_point.hpp"
 #include "grape/serdes/serdes.h"
+#include "grape/serdes/size.h"
 #include "grape/serdes/stream.h"
 
+namespace {
+std::atomic_size_t s_allocation_count{ 0 };  // number of calls to global operator new
+}
+
+//-------------------------------------------------------------------------------------------------
+// Replacement global allocation functions that count allocations made by code under test
+// NOLINTBEGIN(cppcoreguidelines-no-malloc,cppcoreguidelines-owning-memory)
+auto operator new(std::size_t size) -> void* {
+  s_allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (auto* ptr = std::malloc(size); ptr != nullptr) {
+    return ptr;
+  }
+  throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t /*size*/) noexcept {
+  std::free(ptr);
+}
+// NOLINTEND(cppcoreguidelines-no-malloc,cppcoreguidelines-owning-memory)
+
 namespace {
 
 // NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
@@ -213,6 +257,713 @@ TEST_CASE("Serialise custom data structure", "[serdes]") {
   REQUIRE(p2 == p1);
 }
 
+//-------------------------------------------------------------------------------------------------
+struct Reading {
+  std::uint32_t id{};
+  std::string label;
+  std::vector<double> values;
+  std::variant<std::int32_t, std::string> note;
+};
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Decoding into a reused object does not allocate after warm-up", "[serdes]") {
+  // encode a few samples of varying size, with strings too long for small-string optimisation
+  constexpr auto NUM_SAMPLES = 3UZ;
+  auto streams = std::vector<OutStream>(NUM_SAMPLES);
+  for (auto i = 0UZ; i < NUM_SAMPLES; ++i) {
+    const auto reading = Reading{ .id = static_cast<std::uint32_t>(i),
+                                  .label = std::string(32 + (i * 8), 'x'),
+                                  .values = std::vector<double>(20 + (i * 10), 1.5),
+                                  .note = std::string(24 + i, 'y') };
+    auto ser = Serialiser(streams.at(i));
+    REQUIRE(ser.pack(reading));
+  }
+
+  const auto decode_all = [&streams](Reading& target) {
+    auto ok = true;
+    for (const auto& stream : streams) {
+      auto istream = InStream(stream.data());
+      auto des = Deserialiser(istream);
+      ok = ok && des.unpack(target);
+    }
+    return ok;
+  };
+
+  auto target = Reading{};
+  REQUIRE(decode_all(target));  // warm-up: storage grows to fit the largest sample
+
+  constexpr auto NUM_ROUNDS = 10UZ;
+  const auto allocations_before = s_allocation_count.load();
+  auto ok = true;
+  for (auto round = 0UZ; round < NUM_ROUNDS; ++round) {
+    ok = ok && decode_all(target);
+  }
+  const auto allocations = s_allocation_count.load() - allocations_before;
+  REQUIRE(ok);
+  REQUIRE(allocations == 0);
+  REQUIRE(target.id == NUM_SAMPLES - 1);
+  REQUIRE(target.values.size() == 40);
+  REQUIRE(std::get<std::string>(target.note).size() == 26);
+}
+
+//-------------------------------------------------------------------------------------------------
+struct ImuSample {
+  std::int64_t timestamp{};
+  std::array<float, 3> accel{};
+  std::array<float, 3> gyro{};
+  MotorMode mode{};
+  std::array<std::uint8_t, 7> reserved{};
+  auto operator==(const ImuSample&) const -> bool = default;
+};
+
+//-------------------------------------------------------------------------------------------------
+struct PaddedSample {
+  std::uint8_t flags{};
+  double value{};  // preceded by padding
+};
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Padding-free trivially copyable aggregates are copied in bulk", "[serdes]") {
+  STATIC_REQUIRE(grape::serdes::detail::BulkCopyable<Point>);
+  STATIC_REQUIRE(grape::serdes::detail::BulkCopyable<ImuSample>);
+  STATIC_REQUIRE(not grape::serdes::detail::BulkCopyable<PaddedSample>);
+  STATIC_REQUIRE(not grape::serdes::detail::BulkCopyable<Reading>);
+
+  const auto sample = ImuSample{ .timestamp = 123456789,
+                                 .accel = { 0.1F, -9.8F, 0.3F },
+                                 .gyro = { 1.F, 2.F, 3.F },
+                                 .mode = MotorMode::Position,
+                                 .reserved = {} };
+
+  // encoding is identical to encoding member by member
+  auto bulk_stream = OutStream();
+  auto bulk_ser = Serialiser(bulk_stream);
+  REQUIRE(bulk_ser.pack(sample));
+  auto fieldwise_stream = OutStream();
+  auto fieldwise_ser = Serialiser(fieldwise_stream);
+  REQUIRE(fieldwise_ser.pack(sample.timestamp));
+  REQUIRE(fieldwise_ser.pack(sample.accel));
+  REQUIRE(fieldwise_ser.pack(sample.gyro));
+  REQUIRE(fieldwise_ser.pack(sample.mode));
+  REQUIRE(fieldwise_ser.pack(sample.reserved));
+  REQUIRE(bulk_stream.size() == sizeof(ImuSample));
+  REQUIRE(std::ranges::equal(bulk_stream.data(), fieldwise_stream.data()));
+
+  auto istream = InStream(bulk_stream.data());
+  auto des = Deserialiser(istream);
+  auto decoded = ImuSample{};
+  REQUIRE(des.unpack(decoded));
+  REQUIRE(decoded == sample);
+
+  // truncated data is rejected
+  auto short_stream = InStream(bulk_stream.data().first(sizeof(ImuSample) - 1));
+  auto short_des = Deserialiser(short_stream);
+  REQUIRE_FALSE(short_des.unpack(decoded));
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Aggregates with padding are serialised member by member", "[serdes]") {
+  auto ostream = OutStream();
+  auto ser = Serialiser(ostream);
+  const auto sample = PaddedSample{ .flags = 3, .value = 1.5 };
+  REQUIRE(ser.pack(sample));
+  REQUIRE(ostream.size() == sizeof(std::uint8_t) + sizeof(double));
+
+  auto istream = InStream(ostream.data());
+  auto des = Deserialiser(istream);
+  auto decoded = PaddedSample{};
+  REQUIRE(des.unpack(decoded));
+  REQUIRE(decoded.flags == sample.flags);
+  REQUIRE(decoded.value == sample.value);
+}
+
+//-------------------------------------------------------------------------------------------------
+struct Point3f {
+  float x{};
+  float y{};
+  float z{};
+  auto operator==(const Point3f&) const -> bool = default;
+};
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Vectors of fixed-layout aggregates are copied in bulk", "[serdes]") {
+  STATIC_REQUIRE(grape::serdes::detail::BulkCopyable<Point3f>);
+  const auto cloud =
+      std::vector<Point3f>{ { 1.F, 2.F, 3.F }, { 4.F, 5.F, 6.F }, { 7.F, 8.F, 9.F } };
+
+  auto ostream = OutStream();
+  auto ser = Serialiser(ostream);
+  REQUIRE(ser.pack(cloud));
+  REQUIRE(ostream.size() == sizeof(std::size_t) + cloud.size() * sizeof(Point3f));
+
+  // encoding is identical to packing element by element, member by member
+  auto fieldwise_stream = OutStream();
+  auto fieldwise_ser = Serialiser(fieldwise_stream);
+  REQUIRE(fieldwise_ser.pack(cloud.size()));
+  for (const auto& point : cloud) {
+    REQUIRE((fieldwise_ser.pack(point.x) && fieldwise_ser.pack(point.y) &&
+             fieldwise_ser.pack(point.z)));
+  }
+  REQUIRE(std::ranges::equal(ostream.data(), fieldwise_stream.data()));
+
+  auto istream = InStream(ostream.data());
+  auto des = Deserialiser(istream);
+  auto decoded = std::vector<Point3f>{};
+  REQUIRE(des.unpack(decoded));
+  REQUIRE(decoded == cloud);
+
+  // truncated data is rejected
+  auto short_stream = InStream(ostream.data().first(ostream.size() - 1));
+  auto short_des = Deserialiser(short_stream);
+  REQUIRE_FALSE(short_des.unpack(decoded));
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Sequences of aggregates with padding are serialised element by element", "[serdes]") {
+  const auto samples = std::vector<PaddedSample>{ { .flags = 1, .value = 0.5 },
+                                                  { .flags = 2, .value = 1.5 } };
+  const auto pair = std::array<PaddedSample, 2>{ samples.at(0), samples.at(1) };
+
+  auto ostream = OutStream();
+  auto ser = Serialiser(ostream);
+  REQUIRE(ser.pack(samples));
+  REQUIRE(ser.pack(pair));
+  constexpr auto ELEMENT_SIZE = sizeof(std::uint8_t) + sizeof(double);
+  REQUIRE(ostream.size() == sizeof(std::size_t) + 4 * ELEMENT_SIZE);
+
+  auto istream = InStream(ostream.data());
+  auto des = Deserialiser(istream);
+  auto decoded = std::vector<PaddedSample>{};
+  auto decoded_pair = std::array<PaddedSample, 2>{};
+  REQUIRE(des.unpack(decoded));
+  REQUIRE(des.unpack(decoded_pair));
+  REQUIRE(decoded.size() == samples.size());
+  for (auto i = 0UZ; i < samples.size(); ++i) {
+    REQUIRE(decoded.at(i).flags == samples.at(i).flags);
+    REQUIRE(decoded.at(i).value == samples.at(i).value);
+    REQUIRE(decoded_pair.at(i).value == pair.at(i).value);
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Columns are encoded as vectors of their element type", "[serdes]") {
+  using Columns = grape::serdes::Columns<Point3f>;
+  // more points than are transposed at a time, to cover chunking
+  constexpr auto NUM_POINTS = grape::serdes::detail::COLUMN_CHUNK_SIZE<Point3f> + 3;
+  auto cloud = std::vector<Point3f>{};
+  auto columns = Columns{};
+  for (auto i = 0UZ; i < NUM_POINTS; ++i) {
+    const auto v = static_cast<float>(i);
+    cloud.push_back({ .x = v, .y = -v, .z = 2 * v });
+    columns.append(cloud.back());
+  }
+  REQUIRE(columns.size() == NUM_POINTS);
+
+  auto row_stream = grape::serdes::OutStream<16 * 1024>();
+  auto row_ser = grape::serdes::Serialiser(row_stream);
+  REQUIRE(row_ser.pack(cloud));
+  auto column_stream = grape::serdes::OutStream<16 * 1024>();
+  auto column_ser = grape::serdes::Serialiser(column_stream);
+  REQUIRE(column_ser.pack(columns));
+  REQUIRE(std::ranges::equal(row_stream.data(), column_stream.data()));
+
+  // decode rows into columns
+  auto istream = InStream(row_stream.data());
+  auto des = Deserialiser(istream);
+  auto decoded = Columns{};
+  REQUIRE(des.unpack(decoded));
+  REQUIRE(decoded.isUniform());
+  REQUIRE(decoded.size() == NUM_POINTS);
+  for (auto i = 0UZ; i < NUM_POINTS; ++i) {
+    REQUIRE(decoded.column<0>().at(i) == cloud.at(i).x);
+    REQUIRE(decoded.column<1>().at(i) == cloud.at(i).y);
+    REQUIRE(decoded.column<2>().at(i) == cloud.at(i).z);
+  }
+
+  // columns of unequal size are not serialised
+  decoded.column<1>().pop_back();
+  column_stream.reset();
+  REQUIRE_FALSE(column_ser.pack(decoded));
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Columns failing to decode consume nothing", "[serdes]") {
+  // a size the data cannot hold is rejected before allocating
+  auto ostream = OutStream();
+  auto ser = Serialiser(ostream);
+  REQUIRE(ser.pack(std::vector<Point3f>{ { 1.F, 2.F, 3.F }, { 4.F, 5.F, 6.F } }));
+  auto truncated_stream = InStream(ostream.data().first(ostream.size() - 1U));
+  auto truncated_des = Deserialiser(truncated_stream);
+  auto columns = grape::serdes::Columns<Point3f>{};
+  REQUIRE_FALSE(truncated_des.unpack(columns));
+  REQUIRE(truncated_stream.remaining().size() == ostream.size() - 1U);
+
+  // varint elements failing part way through are rewound along with those preceding them
+  using CompactDeserialiser =
+      grape::serdes::Deserialiser<InStream, grape::serdes::CompactIntegerEncoding>;
+  const auto bytes = [](auto... values) { return std::array{ static_cast<std::byte>(values)... }; };
+  const auto partial = bytes(3, 2, 4, 2, 4, 0xFF, 0xFF);  // size, two points, truncated varint
+  auto partial_stream = InStream(partial);
+  auto partial_des = CompactDeserialiser(partial_stream);
+  auto points = grape::serdes::Columns<Point>{};
+  REQUIRE_FALSE(partial_des.unpack(points));
+  REQUIRE(partial_stream.remaining().size() == partial.size());
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Serialise nested sequence containers", "[serdes]") {
+  const auto table = std::vector<std::vector<std::string>>{ { "a", "bc" }, {}, { "def" } };
+  const auto names = std::array<std::string, 2>{ "left", "right" };
+  const auto queue = std::deque<Point>{ { .x = 1, .y = 2 }, { .x = 3, .y = 4 } };
+  const auto history = std::list<std::vector<double>>{ { 1.0 }, { 2.0, 3.0 } };
+
+  auto ostream = OutStream();
+  auto ser = Serialiser(ostream);
+  REQUIRE(ser.pack(table));
+  REQUIRE(ser.pack(names));
+  REQUIRE(ser.pack(queue));
+  REQUIRE(ser.pack(history));
+
+  auto istream = InStream(ostream.data());
+  auto des = Deserialiser(istream);
+  auto decoded_table = std::vector<std::vector<std::string>>{};
+  auto decoded_names = std::array<std::string, 2>{};
+  auto decoded_queue = std::deque<Point>{ { .x = 9, .y = 9 } };  // existing content is replaced
+  auto decoded_history = std::list<std::vector<double>>{};
+  REQUIRE(des.unpack(decoded_table));
+  REQUIRE(des.unpack(decoded_names));
+  REQUIRE(des.unpack(decoded_queue));
+  REQUIRE(des.unpack(decoded_history));
+  REQUIRE(decoded_table == table);
+  REQUIRE(decoded_names == names);
+  REQUIRE(decoded_queue == queue);
+  REQUIRE(decoded_history == history);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Other sequence containers share the encoding of vectors", "[serdes]") {
+  const auto values = std::deque<std::int32_t>{ 1, -2, 3 };
+
+  auto ostream = OutStream();
+  auto ser = Serialiser(ostream);
+  REQUIRE(ser.pack(values));
+
+  auto istream = InStream(ostream.data());
+  auto des = Deserialiser(istream);
+  auto decoded = std::vector<std::int32_t>{};
+  REQUIRE(des.unpack(decoded));
+  REQUIRE(std::ranges::equal(decoded, values));
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Serialise optional", "[serdes]") {
+  const auto present = std::optional<std::string>{ "here" };
+  const auto absent = std::optional<std::string>{};
+
+  auto ostream = OutStream();
+  auto ser = Serialiser(ostream);
+  REQUIRE(ser.pack(absent));
+  REQUIRE(ostream.size() == sizeof(bool));
+  REQUIRE(ser.pack(present));
+
+  auto istream = InStream(ostream.data());
+  auto des = Deserialiser(istream);
+  auto decoded_absent = std::optional<std::string>{ "stale" };
+  auto decoded_present = std::optional<std::string>{};
+  REQUIRE(des.unpack(decoded_absent));
+  REQUIRE(des.unpack(decoded_present));
+  REQUIRE(decoded_absent == absent);
+  REQUIRE(decoded_present == present);
+
+  // truncated value: nothing is consumed
+  auto short_stream = InStream(ostream.data().subspan(sizeof(bool), sizeof(bool) + 1));
+  auto short_des = Deserialiser(short_stream);
+  REQUIRE_FALSE(short_des.unpack(decoded_present));
+  REQUIRE(short_stream.remaining().size() == sizeof(bool) + 1);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Serialise associative containers", "[serdes]") {
+  const auto limits = std::map<std::string, std::pair<double, double>>{
+    { "pan", { -1.5, 1.5 } }, { "tilt", { -0.5, 0.75 } }
+  };
+  const auto ids = std::unordered_map<std::uint32_t, std::vector<std::string>>{
+    { 1U, { "imu" } }, { 2U, { "gps", "rtk" } }
+  };
+  const auto tags = std::set<std::string>{ "front", "rear" };
+  const auto channels = std::unordered_set<std::uint16_t>{ 3, 5, 7 };
+
+  auto ostream = OutStream();
+  auto ser = Serialiser(ostream);
+  REQUIRE(ser.pack(limits));
+  REQUIRE(ser.pack(ids));
+  REQUIRE(ser.pack(tags));
+  REQUIRE(ser.pack(channels));
+
+  auto istream = InStream(ostream.data());
+  auto des = Deserialiser(istream);
+  auto decoded_limits = std::map<std::string, std::pair<double, double>>{ { "stale", {} } };
+  auto decoded_ids = std::unordered_map<std::uint32_t, std::vector<std::string>>{};
+  auto decoded_tags = std::set<std::string>{};
+  auto decoded_channels = std::unordered_set<std::uint16_t>{};
+  REQUIRE(des.unpack(decoded_limits));
+  REQUIRE(des.unpack(decoded_ids));
+  REQUIRE(des.unpack(decoded_tags));
+  REQUIRE(des.unpack(decoded_channels));
+  REQUIRE(decoded_limits == limits);
+  REQUIRE(decoded_ids == ids);
+  REQUIRE(decoded_tags == tags);
+  REQUIRE(decoded_channels == channels);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Sizes that the remaining data cannot hold fail without allocating", "[serdes]") {
+  constexpr auto HUGE_SIZE = 1UZ << 60U;
+  auto ostream = OutStream();
+  auto ser = Serialiser(ostream);
+  REQUIRE(ser.pack(HUGE_SIZE));
+
+  // each fails cleanly rather than throwing on an attempt to allocate, and consumes nothing
+  const auto fails_whole = [&ostream](auto value) {
+    auto istream = InStream(ostream.data());
+    auto des = Deserialiser(istream);
+    return (not des.unpack(value)) && (istream.remaining().size() == ostream.size());
+  };
+  REQUIRE(fails_whole(std::string{}));
+  REQUIRE(fails_whole(std::vector<double>{}));
+  REQUIRE(fails_whole(std::vector<std::string>{}));
+  REQUIRE(fails_whole(std::deque<Point>{}));
+  REQUIRE(fails_whole(std::unordered_map<std::string, int>{}));
+  REQUIRE(fails_whole(std::set<std::uint16_t>{}));
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Containers failing part way through decoding consume nothing", "[serdes]") {
+  // two elements announced, of which only the first is complete: the second is a string whose
+  // size exceeds the data
+  const auto announce_two = [](const auto& first) {
+    auto ostream = OutStream();
+    auto ser = Serialiser(ostream);
+    REQUIRE(ser.pack(2UZ));
+    REQUIRE(ser.pack(first));
+    REQUIRE(ser.pack(std::size_t{ BUF_SIZE }));
+    return ostream;
+  };
+  const auto fails_whole = [](const OutStream& ostream, auto value) {
+    auto istream = InStream(ostream.data());
+    auto des = Deserialiser(istream);
+    return (not des.unpack(value)) && (istream.remaining().size() == ostream.size());
+  };
+  REQUIRE(fails_whole(announce_two(std::string("first")), std::vector<std::string>{}));
+  REQUIRE(fails_whole(announce_two(std::string("first")), std::list<std::string>{}));
+  REQUIRE(fails_whole(announce_two(std::pair<std::string, int>{ "first", 1 }),
+                      std::map<std::string, int>{}));
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Containers failing part way through encoding leave nothing behind", "[serdes]") {
+  // room for the marker, the size and the first element, but not the second element
+  static constexpr auto SMALL_BUF_SIZE = 32U;
+  const auto leaves_marker_only = [](const auto& value) {
+    auto ostream = grape::serdes::OutStream<SMALL_BUF_SIZE>();
+    auto ser = grape::serdes::Serialiser(ostream);
+    REQUIRE(ser.pack(std::uint8_t{ 1 }));
+    return (not ser.pack(value)) && (ostream.size() == sizeof(std::uint8_t));
+  };
+  const auto first = std::string("first");
+  const auto second = std::string(SMALL_BUF_SIZE, 'x');
+  REQUIRE(leaves_marker_only(std::vector<std::string>{ first, second }));
+  REQUIRE(leaves_marker_only(std::list<std::string>{ first, second }));
+  REQUIRE(leaves_marker_only(std::map<std::string, int>{ { first, 1 }, { second, 2 } }));
+  REQUIRE(leaves_marker_only(std::variant<int, std::string>{ second }));
+}
+
+//-------------------------------------------------------------------------------------------------
+struct Calibration {
+  std::optional<std::vector<double>> offsets;
+  std::map<std::string, std::optional<float>> gains;
+  std::vector<std::pair<std::uint8_t, std::string>> notes;
+};
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Serialise aggregates of containers and optionals", "[serdes]") {
+  const auto calibration = Calibration{ .offsets = std::vector<double>{ 0.1, -0.2 },
+                                        .gains = { { "x", 1.5F }, { "y", std::nullopt } },
+                                        .notes = { { 1, "checked" } } };
+
+  auto ostream = OutStream();
+  auto ser = Serialiser(ostream);
+  REQUIRE(ser.pack(calibration));
+
+  auto istream = InStream(ostream.data());
+  auto des = Deserialiser(istream);
+  auto decoded = Calibration{};
+  REQUIRE(des.unpack(decoded));
+  REQUIRE(decoded.offsets == calibration.offsets);
+  REQUIRE(decoded.gains == calibration.gains);
+  REQUIRE(decoded.notes == calibration.notes);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Compact encoding writes sizes as varints", "[serdes]") {
+  using CompactSerialiser = grape::serdes::Serialiser<OutStream, grape::serdes::CompactEncoding>;
+  using CompactDeserialiser = grape::serdes::Deserialiser<InStream, grape::serdes::CompactEncoding>;
+
+  auto ostream = OutStream();
+  auto ser = CompactSerialiser(ostream);
+  const auto short_str = std::string("hello");
+  REQUIRE(ser.pack(short_str));
+  REQUIRE(ostream.size() == 1 + short_str.size());
+
+  const auto long_str = std::string(300, 'x');
+  ostream.reset();
+  REQUIRE(ser.pack(long_str));
+  REQUIRE(ostream.size() == 2 + long_str.size());
+
+  const auto reading = Reading{ .id = 7,
+                                .label = "imu",
+                                .values = { 1.0, 2.0 },
+                                .note = std::variant<std::int32_t, std::string>{ "ok" } };
+  ostream.reset();
+  REQUIRE(ser.pack(reading));
+  // id, label size and label, values size and values, variant index, string size and string
+  REQUIRE(ostream.size() == sizeof(std::uint32_t) + 1 + 3 + 1 + 2 * sizeof(double) + 1 + 1 + 2);
+
+  auto istream = InStream(ostream.data());
+  auto des = CompactDeserialiser(istream);
+  auto decoded = Reading{};
+  REQUIRE(des.unpack(decoded));
+  REQUIRE(decoded.id == reading.id);
+  REQUIRE(decoded.label == reading.label);
+  REQUIRE(decoded.values == reading.values);
+  REQUIRE(decoded.note == reading.note);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Compact integer encoding round trips integers of any sign and magnitude", "[serdes]") {
+  using Encoding = grape::serdes::CompactIntegerEncoding;
+  using CompactSerialiser = grape::serdes::Serialiser<OutStream, Encoding>;
+  using CompactDeserialiser = grape::serdes::Deserialiser<InStream, Encoding>;
+
+  auto ostream = OutStream();
+  auto ser = CompactSerialiser(ostream);
+  REQUIRE(ser.pack(std::int32_t{ -1 }));
+  REQUIRE(ostream.size() == 1);  // zigzag maps small negative values to small codes
+
+  const auto point = Point{ .x = 42, .y = -7 };
+  ostream.reset();
+  REQUIRE(ser.pack(point));
+  REQUIRE(ostream.size() == 2);
+
+  // fixed-layout aggregates in sequences are encoded member by member too
+  const auto points = std::vector<Point>{ point, point };
+  ostream.reset();
+  REQUIRE(ser.pack(points));
+  REQUIRE(ostream.size() == 1 + 2 * 2);
+
+  const auto values = std::vector<std::int64_t>{ 0,  1,  -1, 63, -64, 64, -65,
+                                                 std::numeric_limits<std::int64_t>::max(),
+                                                 std::numeric_limits<std::int64_t>::min() };
+  const auto unsigned_value = std::numeric_limits<std::uint64_t>::max();
+  const auto mode = MotorMode::Velocity;
+  ostream.reset();
+  REQUIRE(ser.pack(values));
+  REQUIRE(ser.pack(unsigned_value));
+  REQUIRE(ser.pack(mode));
+
+  auto istream = InStream(ostream.data());
+  auto des = CompactDeserialiser(istream);
+  auto decoded_values = std::vector<std::int64_t>{};
+  auto decoded_unsigned = std::uint64_t{};
+  auto decoded_mode = MotorMode::Idle;
+  REQUIRE(des.unpack(decoded_values));
+  REQUIRE(des.unpack(decoded_unsigned));
+  REQUIRE(des.unpack(decoded_mode));
+  REQUIRE(decoded_values == values);
+  REQUIRE(decoded_unsigned == unsigned_value);
+  REQUIRE(decoded_mode == mode);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Compact integer encoding rejects truncated and out of range values", "[serdes]") {
+  using Encoding = grape::serdes::CompactIntegerEncoding;
+  using CompactSerialiser = grape::serdes::Serialiser<OutStream, Encoding>;
+  using CompactDeserialiser = grape::serdes::Deserialiser<InStream, Encoding>;
+
+  auto ostream = OutStream();
+  auto ser = CompactSerialiser(ostream);
+  REQUIRE(ser.pack(std::uint32_t{ 300 }));
+  REQUIRE(ostream.size() == 2);
+
+  // truncated varint: nothing is consumed
+  auto short_stream = InStream(ostream.data().first(1));
+  auto short_des = CompactDeserialiser(short_stream);
+  auto value32 = std::uint32_t{};
+  REQUIRE_FALSE(short_des.unpack(value32));
+  REQUIRE(short_stream.remaining().size() == 1);
+
+  // value too large for the destination type: nothing is consumed
+  ostream.reset();
+  REQUIRE(ser.pack(std::numeric_limits<std::uint64_t>::max()));
+  auto istream = InStream(ostream.data());
+  auto des = CompactDeserialiser(istream);
+  auto value16 = std::uint16_t{};
+  REQUIRE_FALSE(des.unpack(value16));
+  REQUIRE(istream.remaining().size() == ostream.size());
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Compact integer encoding rejects varints not in their shortest form", "[serdes]") {
+  using CompactDeserialiser =
+      grape::serdes::Deserialiser<InStream, grape::serdes::CompactIntegerEncoding>;
+  const auto bytes = [](auto... values) { return std::array{ static_cast<std::byte>(values)... }; };
+
+  // ten bytes encoding more than 64 bits: nothing is consumed
+  const auto overflow = bytes(0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F);
+  auto overflow_stream = InStream(overflow);
+  auto overflow_des = CompactDeserialiser(overflow_stream);
+  auto value64 = std::uint64_t{};
+  REQUIRE_FALSE(overflow_des.unpack(value64));
+  REQUIRE(overflow_stream.remaining().size() == overflow.size());
+
+  // largest value in ten bytes is accepted
+  const auto largest = bytes(0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01);
+  auto largest_stream = InStream(largest);
+  auto largest_des = CompactDeserialiser(largest_stream);
+  REQUIRE(largest_des.unpack(value64));
+  REQUIRE(value64 == std::numeric_limits<std::uint64_t>::max());
+
+  // zero padded to two bytes, ahead of an element that fails to decode: nothing is consumed
+  const auto padded = bytes(0x80, 0x00, 0xFF, 0xFF, 0x7F);
+  auto padded_stream = InStream(padded);
+  auto padded_des = CompactDeserialiser(padded_stream);
+  auto values = std::array<std::int16_t, 2>{};
+  REQUIRE_FALSE(padded_des.unpack(values));
+  REQUIRE(padded_stream.remaining().size() == padded.size());
+}
+
+//-------------------------------------------------------------------------------------------------
+/// @return Number of bytes value actually encodes into with the given encoding policy
+template <typename Encoding, typename T>
+auto encodedSize(const T& value) -> std::optional<std::size_t> {
+  auto stream = grape::serdes::ArenaOutStream();
+  auto ser = grape::serdes::Serialiser<grape::serdes::ArenaOutStream, Encoding>(stream);
+  if (not ser.pack(value)) {
+    return std::nullopt;
+  }
+  return stream.size();
+}
+
+//-------------------------------------------------------------------------------------------------
+/// @return true if serialisedSize() matches the encoded length of value with every encoding policy
+template <typename T>
+auto isSizeExact(const T& value) -> bool {
+  using grape::serdes::serialisedSize;
+  return (encodedSize<grape::serdes::FixedEncoding>(value) ==
+          serialisedSize<grape::serdes::FixedEncoding>(value)) &&
+         (encodedSize<grape::serdes::CompactEncoding>(value) ==
+          serialisedSize<grape::serdes::CompactEncoding>(value)) &&
+         (encodedSize<grape::serdes::CompactIntegerEncoding>(value) ==
+          serialisedSize<grape::serdes::CompactIntegerEncoding>(value));
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Serialised size matches encoded length for every type", "[serdes]") {
+  using TimePoint = std::chrono::time_point<std::chrono::system_clock, std::chrono::nanoseconds>;
+  using Var = std::variant<int, float, std::string>;
+
+  REQUIRE(isSizeExact(std::int8_t{ 42 }));
+  REQUIRE(isSizeExact(std::uint16_t{ 1000 }));
+  REQUIRE(isSizeExact(std::int32_t{ -123456 }));
+  REQUIRE(isSizeExact(std::uint64_t{ 9876543210 }));
+  REQUIRE(isSizeExact(std::numeric_limits<std::int64_t>::min()));
+  REQUIRE(isSizeExact(std::numeric_limits<std::uint64_t>::max()));
+  REQUIRE(isSizeExact(true));
+  REQUIRE(isSizeExact(float{ 3.14F }));
+  REQUIRE(isSizeExact(double{ 2.71828 }));
+  REQUIRE(isSizeExact(std::string{ "Hello, World!" }));
+  REQUIRE(isSizeExact(std::string(300, 'x')));
+  REQUIRE(isSizeExact(std::vector<int>{ 1, 2, 3, 4, 5 }));
+  REQUIRE(isSizeExact(std::vector<std::int64_t>{ 0, -1, 1000000 }));
+  REQUIRE(isSizeExact(std::array<double, 3>{ 1.1, 2.2, 3.3 }));
+  REQUIRE(isSizeExact(Var{ 42 }));
+  REQUIRE(isSizeExact(Var{ 3.14F }));
+  REQUIRE(isSizeExact(Var{ std::string("hello") }));
+  REQUIRE(isSizeExact(TimePoint{ std::chrono::nanoseconds{ 123456789 } }));
+  REQUIRE(isSizeExact(MotorMode::Velocity));
+  REQUIRE(isSizeExact(Point{ .x = 42, .y = -7 }));
+  REQUIRE(isSizeExact(Reading{ .id = 7,
+                               .label = "imu",
+                               .values = { 1.0, 2.0 },
+                               .note = std::variant<std::int32_t, std::string>{ "ok" } }));
+  REQUIRE(isSizeExact(ImuSample{ .timestamp = 123456789, .mode = MotorMode::Position }));
+  REQUIRE(isSizeExact(PaddedSample{ .flags = 3, .value = 1.5 }));
+  REQUIRE(isSizeExact(std::vector<Point3f>{ { 1.F, 2.F, 3.F }, { 4.F, 5.F, 6.F } }));
+  REQUIRE(isSizeExact(std::vector<Point>{ { .x = 1, .y = -1 }, { .x = 1000, .y = -1000 } }));
+  REQUIRE(isSizeExact(std::vector<PaddedSample>{ { .flags = 1, .value = 0.5 } }));
+  REQUIRE(isSizeExact(std::array<PaddedSample, 2>{}));
+
+  auto columns = grape::serdes::Columns<Point3f>{};
+  columns.append({ .x = 1.F, .y = 2.F, .z = 3.F });
+  REQUIRE(isSizeExact(columns));
+
+  REQUIRE(isSizeExact(std::vector<std::vector<std::string>>{ { "a", "bc" }, {}, { "def" } }));
+  REQUIRE(isSizeExact(std::array<std::string, 2>{ "left", "right" }));
+  REQUIRE(isSizeExact(std::deque<Point>{ { .x = 1, .y = 2 } }));
+  REQUIRE(isSizeExact(std::list<std::vector<double>>{ { 1.0 }, { 2.0, 3.0 } }));
+  REQUIRE(isSizeExact(std::optional<std::string>{}));
+  REQUIRE(isSizeExact(std::optional<std::string>{ "here" }));
+  REQUIRE(isSizeExact(std::map<std::string, std::pair<double, double>>{ { "pan", { -1., 1. } } }));
+  REQUIRE(isSizeExact(std::unordered_map<std::uint32_t, std::vector<std::string>>{
+      { 1U, { "imu" } }, { 200U, { "gps", "rtk" } } }));
+  REQUIRE(isSizeExact(std::set<std::string>{ "front", "rear" }));
+  REQUIRE(isSizeExact(std::unordered_set<std::uint16_t>{ 3, 500, 7 }));
+  REQUIRE(isSizeExact(Calibration{ .offsets = std::vector<double>{ 0.1, -0.2 },
+                                   .gains = { { "x", 1.5F }, { "y", std::nullopt } },
+                                   .notes = { { 1, "checked" } } }));
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Serialised size is available at compile time", "[serdes]") {
+  using grape::serdes::serialisedSize;
+  STATIC_REQUIRE(serialisedSize(Point{ .x = 1, .y = 2 }) == 2 * sizeof(int));
+  STATIC_REQUIRE(serialisedSize(std::string("abc")) == sizeof(std::size_t) + 3);
+  STATIC_REQUIRE(serialisedSize<grape::serdes::CompactEncoding>(std::vector<double>(3)) ==
+                 1 + 3 * sizeof(double));
+  STATIC_REQUIRE(serialisedSize<grape::serdes::CompactIntegerEncoding>(std::int64_t{ -64 }) == 1);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("Maximum serialised size of types without containers", "[serdes]") {
+  using grape::serdes::BoundedSerialisedSize;
+  using grape::serdes::CompactEncoding;
+  using grape::serdes::CompactIntegerEncoding;
+  using grape::serdes::maxSerialisedSize;
+
+  // every value of these types encodes into the same number of bytes
+  STATIC_REQUIRE(maxSerialisedSize<Point>() == 2 * sizeof(int));
+  STATIC_REQUIRE(maxSerialisedSize<ImuSample>() == sizeof(ImuSample));
+  STATIC_REQUIRE(maxSerialisedSize<PaddedSample>() == sizeof(std::uint8_t) + sizeof(double));
+  STATIC_REQUIRE(maxSerialisedSize<std::array<Point3f, 4>>() == 4 * sizeof(Point3f));
+  STATIC_REQUIRE(maxSerialisedSize<std::chrono::milliseconds>() == sizeof(std::int64_t));
+  REQUIRE(grape::serdes::serialisedSize(ImuSample{}) == maxSerialisedSize<ImuSample>());
+
+  // upper bounds
+  STATIC_REQUIRE(maxSerialisedSize<std::optional<Point>>() == sizeof(bool) + 2 * sizeof(int));
+  STATIC_REQUIRE(maxSerialisedSize<std::variant<std::int8_t, double>>() ==
+                 sizeof(std::size_t) + sizeof(double));
+  STATIC_REQUIRE(maxSerialisedSize<std::variant<std::int8_t, double>, CompactEncoding>() ==
+                 1 + sizeof(double));
+  STATIC_REQUIRE(maxSerialisedSize<std::int32_t, CompactIntegerEncoding>() == 5);
+  STATIC_REQUIRE(maxSerialisedSize<std::uint64_t, CompactIntegerEncoding>() == 10);
+  STATIC_REQUIRE(maxSerialisedSize<Point, CompactIntegerEncoding>() == 10);
+
+  STATIC_REQUIRE(not BoundedSerialisedSize<std::string>);
+  STATIC_REQUIRE(not BoundedSerialisedSize<std::vector<int>>);
+  STATIC_REQUIRE(not BoundedSerialisedSize<Reading>);
+  STATIC_REQUIRE(not BoundedSerialisedSize<std::optional<std::string>>);
+}
+
 // NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
 
 }  // namespace
@@ -2,6 +2,10 @@
 // Copyright (C) 2024 GRAPE Contributors
 //=================================================================================================
 
+#include <array>
+#include <memory_resource>
+#include <string>
+
 #include "catch2/catch_test_macros.hpp"
 #include "grape/serdes/stream.h"
 
@@ -54,6 +58,94 @@ TEST_CASE("OutStream functionality", "[OutStream]") {
   }
 }
 
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("SpanOutStream functionality", "[SpanOutStream]") {
+  auto buffer = std::string(10, '\0');
+  grape::serdes::SpanOutStream out(toSpan(buffer));
+
+  SECTION("Initial state") {
+    REQUIRE(out.size() == 0);
+    REQUIRE(out.capacity() == 10);
+  }
+
+  SECTION("Write data into external buffer") {
+    REQUIRE(out.write(toSpan("Hello")));
+    REQUIRE(out.size() == 5);
+    REQUIRE(toString(out.data()) == "Hello");
+    REQUIRE(buffer.starts_with("Hello"));
+  }
+
+  SECTION("Write beyond capacity") {
+    REQUIRE(out.write(toSpan("HelloWorld")));
+    REQUIRE_FALSE(out.write(toSpan("!")));
+    REQUIRE(out.size() == 10);
+  }
+
+  SECTION("Rewind and reset") {
+    REQUIRE(out.write(toSpan("HelloWorld")));
+    out.rewind(5);
+    REQUIRE(out.size() == 5);
+    out.reset();
+    REQUIRE(out.size() == 0);
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("ArenaOutStream functionality", "[ArenaOutStream]") {
+  auto arena = std::array<std::byte, 64>{};
+  auto resource = std::pmr::monotonic_buffer_resource(arena.data(), arena.size(),
+                                                      std::pmr::null_memory_resource());
+  auto out = grape::serdes::ArenaOutStream(4, &resource);
+
+  SECTION("Initial state") {
+    REQUIRE(out.size() == 0);
+    REQUIRE(out.capacity() == 4);
+  }
+
+  SECTION("Write beyond initial capacity grows the buffer") {
+    REQUIRE(out.write(toSpan("Hello")));
+    REQUIRE(out.capacity() == 8);
+    REQUIRE(out.write(toSpan(", World!")));
+    REQUIRE(out.capacity() == 16);
+    REQUIRE(toString(out.data()) == "Hello, World!");
+  }
+
+  SECTION("Reset retains capacity") {
+    REQUIRE(out.write(toSpan("Hello, World!")));
+    const auto capacity = out.capacity();
+    out.reset();
+    REQUIRE(out.size() == 0);
+    REQUIRE(out.capacity() == capacity);
+    REQUIRE(out.write(toSpan("Hi")));
+    REQUIRE(toString(out.data()) == "Hi");
+  }
+
+  SECTION("Write fails without side effects when the arena is exhausted") {
+    REQUIRE(out.write(toSpan("Hello")));
+    REQUIRE_FALSE(out.write(toSpan(std::string(100, 'x'))));
+    REQUIRE(toString(out.data()) == "Hello");
+  }
+
+  SECTION("Rewind") {
+    REQUIRE(out.write(toSpan("Hello")));
+    out.rewind(2);
+    REQUIRE(toString(out.data()) == "Hel");
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("CountingStream functionality", "[CountingStream]") {
+  grape::serdes::CountingStream out;
+  REQUIRE(out.size() == 0);
+  REQUIRE(out.write(toSpan("Hello")));
+  REQUIRE(out.write(toSpan("World")));
+  REQUIRE(out.size() == 10);
+  out.rewind(5);
+  REQUIRE(out.size() == 5);
+  out.reset();
+  REQUIRE(out.size() == 0);
+}
+
 //-------------------------------------------------------------------------------------------------
 TEST_CASE("InStream functionality", "[InStream]") {
   auto istream = std::string("HelloWorld");
@@ -0,0 +1,146 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <variant>
+#include <vector>
+
+#include "catch2/catch_test_macros.hpp"
+#include "grape/serdes/serdes.h"
+#include "grape/serdes/stream.h"
+#include "grape/serdes/view.h"
+
+namespace {
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+
+constexpr auto VIEW_BUF_SIZE = 1024U;
+using ViewOutStream = grape::serdes::OutStream<VIEW_BUF_SIZE>;
+using ViewSerialiser = grape::serdes::Serialiser<ViewOutStream>;
+
+struct Pose {
+  double x{};
+  double y{};
+  std::array<float, 3> orientation{};
+};
+
+struct Frame {
+  std::uint8_t tag{};
+  std::string name;
+  std::vector<std::int32_t> samples;
+  Pose pose;
+  std::variant<std::int32_t, std::string> extra;
+  std::chrono::nanoseconds stamp{};
+};
+
+//-------------------------------------------------------------------------------------------------
+auto makeFrame() -> Frame {
+  return { .tag = 7,
+           .name = "camera",
+           .samples = { -1, 2, 30000, -400000 },
+           .pose = { .x = 1.5, .y = -2.5, .orientation = { 0.1F, 0.2F, 0.3F } },
+           .extra = std::string("extra"),
+           .stamp = std::chrono::nanoseconds(123456789) };
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("View accesses members in place", "[view]") {
+  const auto frame = makeFrame();
+  auto ostream = ViewOutStream();
+  auto ser = ViewSerialiser(ostream);
+  REQUIRE(ser.pack(frame));
+
+  const auto maybe_view = grape::serdes::View<Frame>::create(ostream.data());
+  REQUIRE(maybe_view.has_value());
+  const auto& view = *maybe_view;
+  STATIC_REQUIRE(grape::serdes::View<Frame>::FIELD_COUNT == 6);
+  REQUIRE(view.bytes().size() == ostream.size());
+
+  REQUIRE(view.get<0>() == 7);
+
+  const auto name = view.get<1>();
+  STATIC_REQUIRE(std::is_same_v<decltype(name), const std::string_view>);
+  REQUIRE(name == "camera");
+  const auto encoded_name = view.bytes().subspan(sizeof(std::uint8_t) + sizeof(std::size_t));
+  REQUIRE(static_cast<const void*>(name.data()) == static_cast<const void*>(encoded_name.data()));
+
+  const auto samples = view.get<2>();
+  REQUIRE(samples.size() == frame.samples.size());
+  for (auto i = 0UZ; i < samples.size(); ++i) {
+    REQUIRE(samples[i] == frame.samples.at(i));
+  }
+
+  const auto pose = view.get<3>();
+  REQUIRE(pose.get<0>() == frame.pose.x);
+  REQUIRE(pose.get<1>() == frame.pose.y);
+  const auto orientation = pose.get<2>();
+  REQUIRE(orientation.size() == 3);
+  REQUIRE(orientation[2] == frame.pose.orientation.at(2));
+
+  REQUIRE(view.get<4>() == frame.extra);
+  REQUIRE(view.get<5>() == frame.stamp);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("View decodes into a value", "[view]") {
+  const auto frame = makeFrame();
+  auto ostream = ViewOutStream();
+  auto ser = ViewSerialiser(ostream);
+  REQUIRE(ser.pack(frame));
+
+  const auto view = grape::serdes::View<Frame>::create(ostream.data());
+  REQUIRE(view.has_value());
+  auto decoded = Frame{};
+  REQUIRE(view->decode(decoded));
+  REQUIRE(decoded.name == frame.name);
+  REQUIRE(decoded.samples == frame.samples);
+  REQUIRE(decoded.pose.orientation == frame.pose.orientation);
+  REQUIRE(decoded.extra == frame.extra);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("View rejects incomplete data", "[view]") {
+  const auto frame = makeFrame();
+  auto ostream = ViewOutStream();
+  auto ser = ViewSerialiser(ostream);
+  REQUIRE(ser.pack(frame));
+  const auto data = ostream.data();
+
+  REQUIRE(grape::serdes::View<Frame>::create(data).has_value());
+  for (auto len = 0UZ; len < data.size(); ++len) {
+    REQUIRE_FALSE(grape::serdes::View<Frame>::create(data.first(len)).has_value());
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("View rejects corrupt sequence length", "[view]") {
+  auto ostream = ViewOutStream();
+  auto ser = ViewSerialiser(ostream);
+  REQUIRE(ser.pack(std::uint8_t{ 1 }));
+  REQUIRE(ser.pack(std::numeric_limits<std::size_t>::max()));  // claimed length of 'name'
+  REQUIRE_FALSE(grape::serdes::View<Frame>::create(ostream.data()).has_value());
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("View ignores trailing bytes", "[view]") {
+  const auto pose = Pose{ .x = 1., .y = 2., .orientation = { 3.F, 4.F, 5.F } };
+  auto ostream = ViewOutStream();
+  auto ser = ViewSerialiser(ostream);
+  REQUIRE(ser.pack(pose));
+  const auto pose_size = ostream.size();
+  REQUIRE(ser.pack(std::uint64_t{ 42 }));
+
+  const auto view = grape::serdes::View<Pose>::create(ostream.data());
+  REQUIRE(view.has_value());
+  REQUIRE(view->bytes().size() == pose_size);
+  REQUIRE(view->get<1>() == 2.);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
+
+}  // namespace
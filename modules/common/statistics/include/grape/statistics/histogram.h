@@ -0,0 +1,180 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+
+namespace grape::statistics {
+
+//=================================================================================================
+// Fixed-memory histogram of unsigned integer values (e.g. latencies in nanoseconds) over their
+// full 64-bit range, with bounded relative error. Suitable for recording in hot paths: recording
+// is a handful of integer operations and never allocates.
+//
+// Buckets are log-linear, as in HdrHistogram: values below 2^PRECISION_BITS are counted exactly;
+// above that, each power-of-two range is split into 2^(PRECISION_BITS-1) equal-width buckets. Any
+// reported value is therefore within a factor of 2^-(PRECISION_BITS-1) of a recorded value
+// (0.8% for the default of 8 bits)
+//
+template <std::size_t PRECISION_BITS = 8>
+class LogLinearHistogram {
+public:
+  /// Number of buckets used to cover the 64-bit range of values
+  static constexpr auto BUCKET_COUNT = (66U - PRECISION_BITS) << (PRECISION_BITS - 1U);
+
+  /// Records occurrences of a value
+  /// @param value Value to record
+  /// @param count Number of times the value occurred
+  constexpr void record(std::uint64_t value, std::uint64_t count = 1U);
+
+  /// Adds all values recorded in another histogram to this one
+  constexpr void merge(const LogLinearHistogram& other);
+
+  /// Clears all recorded values
+  constexpr void reset();
+
+  /// @return Number of values recorded
+  [[nodiscard]] constexpr auto count() const -> std::uint64_t;
+
+  /// @return Smallest value recorded, or 0 if none recorded
+  [[nodiscard]] constexpr auto min() const -> std::uint64_t;
+
+  /// @return Largest value recorded, or 0 if none recorded
+  [[nodiscard]] constexpr auto max() const -> std::uint64_t;
+
+  /// @return Arithmetic mean of values recorded, or 0 if none recorded
+  [[nodiscard]] constexpr auto mean() const -> double;
+
+  /// @param percent Percentile to query, in range [0, 100]
+  /// @return Value at or below which the given percentage of recorded values fall, or 0 if none
+  /// recorded. Reported as the largest value equivalent to it within histogram precision, capped
+  /// at max().
+  [[nodiscard]] constexpr auto percentile(double percent) const -> std::uint64_t;
+
+  /// @return Index of bucket that counts value
+  [[nodiscard]] static constexpr auto bucketIndex(std::uint64_t value) -> std::size_t;
+
+  /// @return Largest value counted by bucket at index
+  [[nodiscard]] static constexpr auto bucketUpperBound(std::size_t index) -> std::uint64_t;
+
+private:
+  static_assert(PRECISION_BITS >= 2U && PRECISION_BITS <= 16U,
+                "PRECISION_BITS must be in range [2, 16]");
+  static constexpr auto HALF_SUB_BUCKETS = std::uint64_t{ 1 } << (PRECISION_BITS - 1U);
+
+  std::array<std::uint64_t, BUCKET_COUNT> buckets_{};
+  std::uint64_t count_{ 0 };
+  std::uint64_t min_{ std::numeric_limits<std::uint64_t>::max() };
+  std::uint64_t max_{ 0 };
+  double sum_{ 0. };
+};
+
+//-------------------------------------------------------------------------------------------------
+template <std::size_t PRECISION_BITS>
+constexpr auto LogLinearHistogram<PRECISION_BITS>::bucketIndex(std::uint64_t value)
+    -> std::size_t {
+  // Values in [0, 2^P) map to themselves. For larger values with most significant bit at
+  // position e, shift g = e - P + 1 keeps the top P bits, which lie in [2^(P-1), 2^P).
+  const auto msb = static_cast<std::size_t>(std::bit_width(value));
+  const auto shift = (msb > PRECISION_BITS) ? (msb - PRECISION_BITS) : 0U;
+  return static_cast<std::size_t>((shift * HALF_SUB_BUCKETS) + (value >> shift));
+}
+
+//-------------------------------------------------------------------------------------------------
+template <std::size_t PRECISION_BITS>
+constexpr auto LogLinearHistogram<PRECISION_BITS>::bucketUpperBound(std::size_t index)
+    -> std::uint64_t {
+  if (index < 2U * HALF_SUB_BUCKETS) {
+    return index;
+  }
+  const auto shift = (index / HALF_SUB_BUCKETS) - 1U;
+  const auto sub_bucket = index - (shift * HALF_SUB_BUCKETS);
+  return ((static_cast<std::uint64_t>(sub_bucket) + 1U) << shift) - 1U;
+}
+
+//-------------------------------------------------------------------------------------------------
+template <std::size_t PRECISION_BITS>
+constexpr void LogLinearHistogram<PRECISION_BITS>::record(std::uint64_t value,
+                                                          std::uint64_t count) {
+  buckets_.at(bucketIndex(value)) += count;
+  count_ += count;
+  min_ = std::min(min_, value);
+  max_ = std::max(max_, value);
+  sum_ += static_cast<double>(value) * static_cast<double>(count);
+}
+
+//-------------------------------------------------------------------------------------------------
+template <std::size_t PRECISION_BITS>
+constexpr void LogLinearHistogram<PRECISION_BITS>::merge(const LogLinearHistogram& other) {
+  for (auto i = 0UZ; i < BUCKET_COUNT; ++i) {
+    buckets_.at(i) += other.buckets_.at(i);
+  }
+  count_ += other.count_;
+  min_ = std::min(min_, other.min_);
+  max_ = std::max(max_, other.max_);
+  sum_ += other.sum_;
+}
+
+//-------------------------------------------------------------------------------------------------
+template <std::size_t PRECISION_BITS>
+constexpr void LogLinearHistogram<PRECISION_BITS>::reset() {
+  buckets_.fill(0U);
+  count_ = 0U;
+  min_ = std::numeric_limits<std::uint64_t>::max();
+  max_ = 0U;
+  sum_ = 0.;
+}
+
+//-------------------------------------------------------------------------------------------------
+template <std::size_t PRECISION_BITS>
+constexpr auto LogLinearHistogram<PRECISION_BITS>::count() const -> std::uint64_t {
+  return count_;
+}
+
+//-------------------------------------------------------------------------------------------------
+template <std::size_t PRECISION_BITS>
+constexpr auto LogLinearHistogram<PRECISION_BITS>::min() const -> std::uint64_t {
+  return (count_ > 0U) ? min_ : 0U;
+}
+
+//-------------------------------------------------------------------------------------------------
+template <std::size_t PRECISION_BITS>
+constexpr auto LogLinearHistogram<PRECISION_BITS>::max() const -> std::uint64_t {
+  return max_;
+}
+
+//-------------------------------------------------------------------------------------------------
+template <std::size_t PRECISION_BITS>
+constexpr auto LogLinearHistogram<PRECISION_BITS>::mean() const -> double {
+  return (count_ > 0U) ? (sum_ / static_cast<double>(count_)) : 0.;
+}
+
+//-------------------------------------------------------------------------------------------------
+template <std::size_t PRECISION_BITS>
+constexpr auto LogLinearHistogram<PRECISION_BITS>::percentile(double percent) const
+    -> std::uint64_t {
+  if (count_ == 0U) {
+    return 0U;
+  }
+  // rank of the value sought, counting from 1
+  const auto fraction = std::clamp(percent, 0., 100.) / 100.;
+  const auto rank = std::max<std::uint64_t>(
+      static_cast<std::uint64_t>(std::ceil(fraction * static_cast<double>(count_))), 1U);
+  auto cumulative = std::uint64_t{ 0 };
+  for (auto i = 0UZ; i < BUCKET_COUNT; ++i) {
+    cumulative += buckets_.at(i);
+    if (cumulative >= rank) {
+      return std::min(bucketUpperBound(i), max_);
+    }
+  }
+  return max_;
+}
+
+}  // namespace grape::statistics
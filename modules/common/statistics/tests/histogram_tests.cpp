@@ -0,0 +1,104 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#include <cstdint>
+#include <limits>
+#include <memory>
+
+#include "catch2/catch_approx.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include "grape/statistics/histogram.h"
+
+namespace {
+
+// NOLINTBEGIN(cppcoreguidelines-avoid-magic-numbers)
+
+using Histogram = grape::statistics::LogLinearHistogram<>;
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("LogLinearHistogram: Buckets cover the full range contiguously",
+          "[statistics][histogram]") {
+  STATIC_REQUIRE(Histogram::bucketIndex(0) == 0);
+  STATIC_REQUIRE(Histogram::bucketIndex(std::numeric_limits<std::uint64_t>::max()) ==
+                 Histogram::BUCKET_COUNT - 1);
+  STATIC_REQUIRE(Histogram::bucketUpperBound(Histogram::BUCKET_COUNT - 1) ==
+                 std::numeric_limits<std::uint64_t>::max());
+
+  // every bucket starts where the previous one ends, and values map back to their own bucket
+  for (auto i = 1UZ; i < Histogram::BUCKET_COUNT; ++i) {
+    const auto lower = Histogram::bucketUpperBound(i - 1) + 1;
+    REQUIRE(lower <= Histogram::bucketUpperBound(i));
+    REQUIRE(Histogram::bucketIndex(lower) == i);
+    REQUIRE(Histogram::bucketIndex(Histogram::bucketUpperBound(i)) == i);
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("LogLinearHistogram: Small values are exact", "[statistics][histogram]") {
+  auto hist = std::make_unique<Histogram>();
+  for (auto value = 1U; value <= 100U; ++value) {
+    hist->record(value);
+  }
+  REQUIRE(hist->count() == 100);
+  REQUIRE(hist->min() == 1);
+  REQUIRE(hist->max() == 100);
+  REQUIRE(hist->mean() == Catch::Approx(50.5));
+  REQUIRE(hist->percentile(50.) == 50);
+  REQUIRE(hist->percentile(90.) == 90);
+  REQUIRE(hist->percentile(99.) == 99);
+  REQUIRE(hist->percentile(100.) == 100);
+  REQUIRE(hist->percentile(0.) == 1);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("LogLinearHistogram: Large values are within relative precision",
+          "[statistics][histogram]") {
+  auto hist = std::make_unique<Histogram>();
+  constexpr auto NUM_VALUES = 100'000U;
+  constexpr auto SCALE = 1'000U;  // e.g. microseconds expressed in nanoseconds
+  for (auto i = 1U; i <= NUM_VALUES; ++i) {
+    hist->record(static_cast<std::uint64_t>(i) * SCALE);
+  }
+  constexpr auto TOLERANCE = 1. / 128.;
+  for (const auto percent : { 50., 90., 99., 99.9 }) {
+    const auto expected = percent / 100. * NUM_VALUES * SCALE;
+    const auto reported = static_cast<double>(hist->percentile(percent));
+    REQUIRE(reported >= expected);
+    REQUIRE(reported <= expected * (1. + TOLERANCE));
+  }
+  REQUIRE(hist->percentile(100.) == static_cast<std::uint64_t>(NUM_VALUES) * SCALE);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("LogLinearHistogram: Tail is visible", "[statistics][histogram]") {
+  auto hist = std::make_unique<Histogram>();
+  hist->record(10'000, 999);
+  hist->record(5'000'000);
+  REQUIRE(hist->percentile(99.) <= 10'100);
+  REQUIRE(hist->percentile(99.95) >= 5'000'000);
+  REQUIRE(hist->max() == 5'000'000);
+}
+
+//-------------------------------------------------------------------------------------------------
+TEST_CASE("LogLinearHistogram: Merge and reset", "[statistics][histogram]") {
+  auto first = std::make_unique<Histogram>();
+  auto second = std::make_unique<Histogram>();
+  first->record(10);
+  second->record(1000, 3);
+  first->merge(*second);
+  REQUIRE(first->count() == 4);
+  REQUIRE(first->min() == 10);
+  REQUIRE(first->max() == 1000);
+  REQUIRE(first->percentile(25.) == 10);
+
+  first->reset();
+  REQUIRE(first->count() == 0);
+  REQUIRE(first->min() == 0);
+  REQUIRE(first->max() == 0);
+  REQUIRE(first->percentile(50.) == 0);
+}
+
+// NOLINTEND(cppcoreguidelines-avoid-magic-numbers)
+
+}  // namespace
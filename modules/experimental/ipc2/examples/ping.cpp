@@ -68,7 +68,8 @@ auto main(int argc, const char* argv[]) -> int {
     auto session = grape::ipc2::Session(config);
 
     // prepare publisher
-    auto pub = session.createPublisher({ .key = grape::ipc2::ex::ping::PING_TOPIC });
+    auto pub = session.createPublisher(
+        { .key = grape::ipc2::ex::ping::PING_TOPIC, .qos = { .is_express = true } });
 
     std::mutex pong_mut;
     std::condition_variable pong_cond;
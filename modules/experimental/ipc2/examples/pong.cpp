@@ -67,7 +67,8 @@ auto main(int argc, const char* argv[]) -> int {
       std::println("Router: '{}'", router_str);
     }
     auto session = grape::ipc2::Session(config);
-    auto pub = session.createPublisher({ .key = grape::ipc2::ex::ping::PONG_TOPIC });
+    auto pub = session.createPublisher(
+        { .key = grape::ipc2::ex::ping::PONG_TOPIC, .qos = { .is_express = true } });
 
     const auto cb = [&pub](const std::span<const std::byte> bytes) {
       const auto payload_len = bytes.size_bytes();
@@ -0,0 +1,207 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <memory>
+#include <span>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <sys/wait.h>  // for waitpid
+#include <unistd.h>    // for fork
+
+#include "grape/ipc2/session.h"
+
+//=================================================================================================
+// Shows the tradeoffs between publisher QoS settings when a subscriber cannot keep up. Messages are
+// published as fast as possible to a subscriber in a separate process that takes a fixed time to
+// process each one. The subscriber periodically reports the number of messages it has received.
+//
+// Reported for each setting:
+// - Time per iteration: Time taken by a call to publish. Blocking congestion control is expected to
+//   hold it to the pace of the slow subscriber, and dropping congestion control not to.
+// - publish_max_us: Longest time taken by a call to publish
+// - delivered: Rate of messages processed by the subscriber
+// - delivered_fraction: Fraction of published messages that the subscriber processed
+//
+// Express publishers send each message immediately instead of batching it with others.
+//=================================================================================================
+
+namespace {
+
+using QoS = grape::ipc2::PublisherQoS;
+
+constexpr auto DATA_KEY_PREFIX = "grape/ipc2/bench/qos/data";
+constexpr auto COUNT_KEY = "grape/ipc2/bench/qos/count";
+constexpr auto SUBSCRIBER_PROCESSING_TIME = std::chrono::microseconds(100);
+constexpr auto COUNT_REPORT_PERIOD = std::chrono::milliseconds(10);
+
+//-------------------------------------------------------------------------------------------------
+// Runs in a child process. Processes messages slowly and reports the count processed, until the
+// parent exits
+void runSlowSubscriber() {
+  auto session = grape::ipc2::Session({});
+  auto count = std::atomic<std::uint64_t>{ 0 };
+  auto sub = session.createSubscriber(std::string(DATA_KEY_PREFIX) + "/**", [&count](auto) {
+    std::this_thread::sleep_for(SUBSCRIBER_PROCESSING_TIME);
+    count++;
+  });
+  auto reporter = session.createPublisher({ .key = COUNT_KEY, .qos = { .is_express = true } });
+  while (getppid() != 1) {
+    const auto value = count.load();
+    reporter.publish(std::as_bytes(std::span{ &value, 1 }));
+    std::this_thread::sleep_for(COUNT_REPORT_PERIOD);
+  }
+}
+
+//=================================================================================================
+/// Tracks the latest count of messages reported by the slow subscriber
+class DeliveryMonitor {
+public:
+  DeliveryMonitor()
+    : subscriber_(session_.createSubscriber(COUNT_KEY, [this](auto bytes) {
+      auto value = std::uint64_t{ 0 };
+      if (bytes.size_bytes() == sizeof(value)) {
+        std::memcpy(&value, bytes.data(), sizeof(value));
+        count_.store(value);
+        reported_.store(true);
+      }
+    })) {
+  }
+
+  [[nodiscard]] auto count() const -> std::uint64_t {
+    return count_.load();
+  }
+
+  /// @return true once the slow subscriber has been heard from
+  [[nodiscard]] auto isConnected() const -> bool {
+    return reported_.load();
+  }
+
+  [[nodiscard]] auto session() -> grape::ipc2::Session& {
+    return session_;
+  }
+
+private:
+  std::atomic<std::uint64_t> count_{ 0 };
+  std::atomic_bool reported_{ false };
+  grape::ipc2::Session session_{ {} };
+  grape::ipc2::Subscriber subscriber_;
+};
+
+//-------------------------------------------------------------------------------------------------
+/// Wait until the count reported by the subscriber stops changing, ie: it has drained its backlog
+void waitForQuiescence(const DeliveryMonitor& monitor) {
+  static constexpr auto SETTLE_TIME = std::chrono::milliseconds(250);
+  auto last = monitor.count();
+  while (true) {
+    std::this_thread::sleep_for(SETTLE_TIME);
+    const auto now = monitor.count();
+    if (now == last) {
+      return;
+    }
+    last = now;
+  }
+}
+
+//-------------------------------------------------------------------------------------------------
+void bmPublish(benchmark::State& state, QoS qos) {
+  static auto monitor = std::make_unique<DeliveryMonitor>();
+  static constexpr auto CONNECT_ATTEMPTS = 50;
+  static constexpr auto CONNECT_WAIT = std::chrono::milliseconds(100);
+  for (auto i = 0; (i < CONNECT_ATTEMPTS) and not monitor->isConnected(); ++i) {
+    std::this_thread::sleep_for(CONNECT_WAIT);
+  }
+  if (not monitor->isConnected()) {
+    state.SkipWithError("Subscriber not reachable");
+    return;
+  }
+
+  static auto key_suffix = 0;
+  const auto key = std::format("{}/{}", DATA_KEY_PREFIX, key_suffix++);
+  auto publisher = monitor->session().createPublisher({ .key = key, .qos = qos });
+  const auto payload = std::vector<std::byte>(static_cast<std::size_t>(state.range(0)));
+
+  waitForQuiescence(*monitor);
+  const auto delivered_start = monitor->count();
+  const auto start_time = std::chrono::steady_clock::now();
+  auto max_publish_time = std::chrono::steady_clock::duration{};
+  for (auto st : state) {
+    (void)st;
+    const auto ts = std::chrono::steady_clock::now();
+    publisher.publish(payload);
+    max_publish_time = std::max(max_publish_time, std::chrono::steady_clock::now() - ts);
+  }
+  const auto publish_duration = std::chrono::steady_clock::now() - start_time;
+
+  // Count only messages the subscriber processed within the time it took to publish them. Messages
+  // still queued up at the end do not count as delivered
+  std::this_thread::sleep_for(2 * COUNT_REPORT_PERIOD);
+  const auto delivered = static_cast<double>(monitor->count() - delivered_start);
+  const auto published = static_cast<double>(state.iterations());
+  const auto seconds = std::chrono::duration<double>(publish_duration).count();
+  state.counters["publish_max_us"] =
+      std::chrono::duration<double, std::micro>(max_publish_time).count();
+  state.counters["delivered"] = benchmark::Counter(delivered / seconds);
+  state.counters["delivered_fraction"] = delivered / published;
+}
+
+constexpr auto SMALL_MESSAGE_SIZE = 64;
+constexpr auto LARGE_MESSAGE_SIZE = 64 * 1024;
+
+constexpr auto BLOCK_BATCHED = QoS{ .congestion_control = QoS::CongestionControl::Block };
+constexpr auto BLOCK_EXPRESS =
+    QoS{ .congestion_control = QoS::CongestionControl::Block, .is_express = true };
+constexpr auto DROP_BATCHED = QoS{ .congestion_control = QoS::CongestionControl::Drop };
+constexpr auto DROP_EXPRESS =
+    QoS{ .congestion_control = QoS::CongestionControl::Drop, .is_express = true };
+
+BENCHMARK_CAPTURE(bmPublish, block_batched, BLOCK_BATCHED)
+    ->Arg(SMALL_MESSAGE_SIZE)
+    ->Arg(LARGE_MESSAGE_SIZE)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(bmPublish, block_express, BLOCK_EXPRESS)
+    ->Arg(SMALL_MESSAGE_SIZE)
+    ->Arg(LARGE_MESSAGE_SIZE)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(bmPublish, drop_batched, DROP_BATCHED)
+    ->Arg(SMALL_MESSAGE_SIZE)
+    ->Arg(LARGE_MESSAGE_SIZE)
+    ->UseRealTime();
+BENCHMARK_CAPTURE(bmPublish, drop_express, DROP_EXPRESS)
+    ->Arg(SMALL_MESSAGE_SIZE)
+    ->Arg(LARGE_MESSAGE_SIZE)
+    ->UseRealTime();
+
+}  // namespace
+
+//=================================================================================================
+auto main(int argc, char** argv) -> int {
+  // fork the subscriber before any session is opened in this process
+  const auto pid = fork();
+  if (pid < 0) {
+    return EXIT_FAILURE;
+  }
+  if (pid == 0) {
+    runSlowSubscriber();
+    return EXIT_SUCCESS;
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  kill(pid, SIGTERM);
+  waitpid(pid, nullptr, 0);
+  return EXIT_SUCCESS;
+}
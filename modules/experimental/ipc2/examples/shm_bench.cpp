@@ -0,0 +1,212 @@
+//=================================================================================================
+// Copyright (C) 2026 GRAPE Contributors
+//=================================================================================================
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <format>
+#include <memory>
+#include <semaphore>
+#include <span>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+#include <sys/wait.h>  // for waitpid
+#include <unistd.h>    // for fork
+
+#include "grape/ipc2/session.h"
+
+//=================================================================================================
+// Compares transfer of messages between processes on the same host over the network transport
+// against shared memory. Each iteration sends a message to an echo process, which acknowledges it
+// with a short reply carrying the message's sequence number. In shared-memory mode, the message
+// is written in place into a loaned shared-memory buffer and read in place by the echo.
+//
+// The echo processes for both modes are forked at startup.
+//=================================================================================================
+
+namespace {
+
+enum class Transport : std::uint8_t { Network, SharedMemory };
+
+using Sequence = std::uint64_t;
+
+//-------------------------------------------------------------------------------------------------
+auto sessionConfig(Transport transport) -> grape::ipc2::Session::Config {
+  auto config = grape::ipc2::Session::Config{};
+  if (transport == Transport::SharedMemory) {
+    config.shared_memory = grape::ipc2::Session::SharedMemoryConfig{};
+  }
+  return config;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Keys are distinct per transport so that the two echo processes do not answer each other's senders
+auto keyPrefix(Transport transport) -> std::string_view {
+  return (transport == Transport::SharedMemory) ? "grape/ipc2/bench/shm" : "grape/ipc2/bench/net";
+}
+
+//-------------------------------------------------------------------------------------------------
+auto messageKey(Transport transport) -> std::string {
+  return std::format("{}/message", keyPrefix(transport));
+}
+
+//-------------------------------------------------------------------------------------------------
+auto ackKey(Transport transport) -> std::string {
+  return std::format("{}/ack", keyPrefix(transport));
+}
+
+//-------------------------------------------------------------------------------------------------
+auto readSequence(std::span<const std::byte> bytes) -> Sequence {
+  auto seq = Sequence{ 0 };
+  if (bytes.size_bytes() >= sizeof(seq)) {
+    std::memcpy(&seq, bytes.data(), sizeof(seq));
+  }
+  return seq;
+}
+
+//-------------------------------------------------------------------------------------------------
+// Runs in a child process. Acknowledges every message received until the parent exits
+void runEcho(Transport transport) {
+  auto session = grape::ipc2::Session(sessionConfig(transport));
+  auto ack = session.createPublisher({ .key = ackKey(transport) });
+  auto sub = session.createSubscriber(messageKey(transport), [&ack](auto bytes) {
+    const auto seq = readSequence(bytes);
+    ack.publish(std::as_bytes(std::span{ &seq, 1 }));
+  });
+  static constexpr auto LOOP_WAIT = std::chrono::milliseconds(100);
+  while (getppid() != 1) {
+    std::this_thread::sleep_for(LOOP_WAIT);
+  }
+}
+
+//=================================================================================================
+/// Sends messages to the echo process of a transport mode and waits for their acknowledgements
+class Sender {
+public:
+  explicit Sender(Transport transport)
+    : session_(sessionConfig(transport))
+    , publisher_(session_.createPublisher({ .key = messageKey(transport) }))
+    , subscriber_(session_.createSubscriber(ackKey(transport), [this](auto bytes) {
+      if (readSequence(bytes) == expected_seq_.load()) {
+        acked_.release();
+      }
+    })) {
+  }
+
+  /// @return true if message was acknowledged in time
+  auto send(std::size_t size, std::chrono::milliseconds timeout) -> bool {
+    seq_++;
+    expected_seq_.store(seq_);
+    auto buffer = publisher_.loan(size);
+    if (buffer.has_value()) {
+      std::memcpy(buffer->data().data(), &seq_, sizeof(seq_));
+      publisher_.publish(std::move(*buffer));
+    } else {
+      payload_.resize(size);
+      std::memcpy(payload_.data(), &seq_, sizeof(seq_));
+      publisher_.publish(payload_);
+    }
+    return acked_.try_acquire_for(timeout);
+  }
+
+  /// Wait until the echo process is reachable
+  /// @return false if not reachable in time
+  auto connect() -> bool {
+    static constexpr auto ATTEMPTS = 50;
+    static constexpr auto ATTEMPT_TIMEOUT = std::chrono::milliseconds(200);
+    for (auto i = 0; i < ATTEMPTS; ++i) {
+      if (send(sizeof(Sequence), ATTEMPT_TIMEOUT)) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+private:
+  Sequence seq_{ 0 };
+  std::atomic<Sequence> expected_seq_{ 0 };
+  std::binary_semaphore acked_{ 0 };
+  std::vector<std::byte> payload_;
+  grape::ipc2::Session session_;
+  grape::ipc2::Publisher publisher_;
+  grape::ipc2::Subscriber subscriber_;
+};
+
+//-------------------------------------------------------------------------------------------------
+void bmTransfer(benchmark::State& state, Transport transport) {
+  static auto senders = std::array<std::unique_ptr<Sender>, 2>{};
+  auto& sender = senders.at(static_cast<std::size_t>(transport));
+  if (sender == nullptr) {
+    sender = std::make_unique<Sender>(transport);
+    if (not sender->connect()) {
+      state.SkipWithError("Echo not reachable");
+      return;
+    }
+  }
+
+  static constexpr auto TIMEOUT = std::chrono::milliseconds(1000);
+  const auto size = static_cast<std::size_t>(state.range(0));
+  for (auto st : state) {
+    (void)st;
+    if (not sender->send(size, TIMEOUT)) {
+      state.SkipWithError("Acknowledgement timed out");
+      return;
+    }
+  }
+  state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+//-------------------------------------------------------------------------------------------------
+void bmTransferNetwork(benchmark::State& state) {
+  bmTransfer(state, Transport::Network);
+}
+
+//-------------------------------------------------------------------------------------------------
+void bmTransferSharedMemory(benchmark::State& state) {
+  bmTransfer(state, Transport::SharedMemory);
+}
+
+constexpr auto MIN_SIZE = 64;
+constexpr auto MAX_SIZE = 8 * 1024 * 1024;
+constexpr auto SIZE_MULTIPLIER = 8;
+
+BENCHMARK(bmTransferNetwork)->RangeMultiplier(SIZE_MULTIPLIER)->Range(MIN_SIZE, MAX_SIZE);
+BENCHMARK(bmTransferSharedMemory)->RangeMultiplier(SIZE_MULTIPLIER)->Range(MIN_SIZE, MAX_SIZE);
+
+}  // namespace
+
+//=================================================================================================
+auto main(int argc, char** argv) -> int {
+  // fork echo processes before any session is opened in this process
+  auto echo_pids = std::vector<pid_t>{};
+  for (const auto transport : { Transport::Network, Transport::SharedMemory }) {
+    const auto pid = fork();
+    if (pid < 0) {
+      return EXIT_FAILURE;
+    }
+    if (pid == 0) {
+      runEcho(transport);
+      return EXIT_SUCCESS;
+    }
+    echo_pids.push_back(pid);
+  }
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  for (const auto pid : echo_pids) {
+    kill(pid, SIGTERM);
+    waitpid(pid, nullptr, 0);
+  }
+  return EXIT_SUCCESS;
+}
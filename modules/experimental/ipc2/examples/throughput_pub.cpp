@@ -2,6 +2,7 @@
 // Copyright (C) 2023 GRAPE Contributors
 //=================================================================================================
 
+#include <algorithm>
 #include <print>
 
 #include "grape/conio/program_options.h"
@@ -14,9 +15,12 @@
 //
 // Typical usage:
 // ```code
-// throughput_pub [--size=8 --router="proto/address:port"]
+// throughput_pub [--size=8 --router="proto/address:port" --shm=true]
 // ```
 //
+// With `--shm=true`, messages are written in place into loaned shared-memory buffers and reach a
+// subscriber on the same host (also started with `--shm=true`) without copying.
+//
 // Paired with example: throughput_sub.cpp
 //
 // Derived from:
@@ -33,6 +37,7 @@ auto main(int argc, const char* argv[]) -> int {
         grape::conio::ProgramDescription("Publisher end of throughput measurement example")
             .declareOption<std::size_t>("size", "payload size in bytes", DEFAULT_PAYLOAD_SIZE)
             .declareOption<std::string>("router", "Router locator", "none")
+            .declareOption<bool>("shm", "Use shared-memory transport", false)
             .parse(argc, argv);
     if (not maybe_args.has_value()) {
       grape::panic<grape::Exception>(toString(maybe_args.error()));
@@ -54,13 +59,24 @@ auto main(int argc, const char* argv[]) -> int {
       }
       std::println("Router: '{}'", router_str);
     }
+    const auto use_shm = args.getOptionOrThrow<bool>("shm");
+    if (use_shm) {
+      config.shared_memory = grape::ipc2::Session::SharedMemoryConfig{};
+      std::println("Shared memory: enabled");
+    }
     auto session = grape::ipc2::Session(config);
 
     auto pub = session.createPublisher({ .key = grape::ipc2::ex::throughput::TOPIC });
 
     std::println("Press CTRL-C to quit");
     while (true) {
-      pub.publish(value);
+      auto buffer = use_shm ? pub.loan(payload_size) : std::nullopt;
+      if (buffer.has_value()) {
+        std::ranges::fill(buffer->data(), static_cast<std::byte>(DEFAULT_PAYLOAD_FILL));
+        pub.publish(std::move(*buffer));
+      } else {
+        pub.publish(value);
+      }
     }
     return EXIT_SUCCESS;
   } catch (...) {
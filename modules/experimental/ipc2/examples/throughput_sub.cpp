@@ -19,7 +19,7 @@
 //
 // Typical usage:
 // ```code
-// throughput_sub [--router="proto/address:port"]
+// throughput_sub [--router="proto/address:port" --shm=true]
 // ```
 //
 // Paired with example: throughput_pub.cpp
@@ -57,6 +57,7 @@ auto main(int argc, const char* argv[]) -> int {
     const auto maybe_args =
         grape::conio::ProgramDescription("Measures throughput from publisher example")
             .declareOption<std::string>("router", "Router locator", "none")
+            .declareOption<bool>("shm", "Use shared-memory transport", false)
             .parse(argc, argv);
     if (not maybe_args.has_value()) {
       grape::panic<grape::Exception>(toString(maybe_args.error()));
@@ -75,6 +76,10 @@ auto main(int argc, const char* argv[]) -> int {
       }
       std::println("Router: '{}'", router_str);
     }
+    if (args.getOptionOrThrow<bool>("shm")) {
+      config.shared_memory = grape::ipc2::Session::SharedMemoryConfig{};
+      std::println("Shared memory: enabled");
+    }
     auto session = grape::ipc2::Session(config);
 
     Statistics stats;
@@ -4,24 +4,59 @@
 
 #pragma once
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <span>
 
 namespace zenoh {
 class Publisher;
+class PosixShmProvider;
+class ZShmMut;
 }  // namespace zenoh
 
 namespace grape::ipc2 {
 
 class Session;
 
+//=================================================================================================
+/// Buffer in shared memory, loaned by a Publisher to write a message into in place. Publishing it
+/// hands it over to subscribers on the same host without copying. See Publisher::loan
+class ShmBuffer {
+public:
+  /// @return Memory to write the message into
+  [[nodiscard]] auto data() -> std::span<std::byte>;
+
+  ~ShmBuffer();
+  ShmBuffer(const ShmBuffer&) = delete;
+  auto operator=(const ShmBuffer&) = delete;
+  ShmBuffer(ShmBuffer&&) noexcept;
+  auto operator=(ShmBuffer&&) noexcept -> ShmBuffer&;
+
+private:
+  friend class Publisher;
+  explicit ShmBuffer(std::unique_ptr<zenoh::ZShmMut> zbuf);
+  std::unique_ptr<zenoh::ZShmMut> impl_;
+};
+
 //=================================================================================================
 /// Publishers post topic data. Created by Session. See also Topic.
 class Publisher {
 public:
+  /// Publish message. If shared memory is enabled in the session and the message is large enough
+  /// (see Session::SharedMemoryConfig), it is copied into shared memory and sent from there
   void publish(std::span<const std::byte> bytes);
   void publish(std::span<const char> bytes);
 
+  /// Publish message written in place into a loaned shared-memory buffer, without copying it
+  void publish(ShmBuffer&& buffer);
+
+  /// Loan a buffer in shared memory to write a message into
+  /// @param size Size of the message in bytes
+  /// @return Buffer, or nothing if shared memory is not enabled in the session or the pool of
+  /// buffers is exhausted
+  [[nodiscard]] auto loan(std::size_t size) -> std::optional<ShmBuffer>;
+
   ~Publisher();
   Publisher(const Publisher&) = delete;
   auto operator=(const Publisher&) = delete;
@@ -30,8 +65,12 @@ public:
 
 private:
   friend class Session;
-  explicit Publisher(std::unique_ptr<zenoh::Publisher> zp);
+  Publisher(std::unique_ptr<zenoh::Publisher> zp,
+            std::shared_ptr<zenoh::PosixShmProvider> shm_provider,
+            std::size_t shm_min_message_size);
   std::unique_ptr<zenoh::Publisher> impl_;
+  std::shared_ptr<zenoh::PosixShmProvider> shm_provider_;  // shared with session. Null if disabled
+  std::size_t shm_min_message_size_{ 0 };
 };
 
 }  // namespace grape::ipc2
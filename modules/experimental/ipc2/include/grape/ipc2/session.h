@@ -4,6 +4,12 @@
 
 #pragma once
 
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
 #include "grape/ipc2/common.h"
 #include "grape/ipc2/publisher.h"
 #include "grape/ipc2/subscriber.h"
@@ -11,7 +17,8 @@
 
 namespace zenoh {
 class Session;
-}
+class PosixShmProvider;
+}  // namespace zenoh
 
 namespace grape::ipc2 {
 
@@ -29,10 +36,29 @@ public:
     Router   //!< Route data between clients and local subnetworks of peers
   };
 
+  /// Shared-memory transport parameters. See Config::shared_memory
+  ///
+  /// Shared memory is used only between sessions on the same host that both enable it; otherwise
+  /// data falls back to the network transport. Subscribers are notified of each message in shared
+  /// memory over the network transport, so the benefit is in throughput of large messages rather
+  /// than latency of small ones.
+  struct SharedMemoryConfig {
+    static constexpr auto DEFAULT_POOL_SIZE = 64UZ * 1024UZ * 1024UZ;
+    static constexpr auto DEFAULT_MIN_MESSAGE_SIZE = 4UZ * 1024UZ;
+
+    /// Total size of shared-memory buffers available to publishers in this session
+    std::size_t pool_size{ DEFAULT_POOL_SIZE };
+
+    /// Messages published from ordinary memory are copied into shared memory only if at least
+    /// this large. Smaller ones go over the network transport, which is cheaper for them
+    std::size_t min_message_size{ DEFAULT_MIN_MESSAGE_SIZE };
+  };
+
   /// Session configuration parameters
   struct Config {
-    Session::Mode mode{ Session::Mode::Peer };  //!< Operating mode
-    std::optional<Locator> router;              //!< Router to connect to
+    Session::Mode mode{ Session::Mode::Peer };        //!< Operating mode
+    std::optional<Locator> router;                    //!< Router to connect to
+    std::optional<SharedMemoryConfig> shared_memory;  //!< Enables shared-memory transport if set
   };
 
   explicit Session(const Config& config);
@@ -48,12 +74,13 @@ public:
 
   /// creates a publisher
   /// @param topic topic attributes
-  /// @return publisher
+  /// @return publisher. Able to loan shared-memory buffers if shared memory is enabled
   [[nodiscard]] auto createPublisher(const Topic& topic) -> Publisher;
 
   /// creates a subscriber
   /// @param topic Topic on which to listen to for data from matched publishers
-  /// @param cb Data processing callback, triggered on every new sample post on a matching topic
+  /// @param cb Data processing callback, triggered on every new sample post on a matching topic.
+  /// Samples received over shared memory are passed to it in place, without copying
   /// @return subscriber
   [[nodiscard]] auto createSubscriber(const std::string& topic, DataCallback&& cb) -> Subscriber;
 
@@ -65,6 +92,8 @@ public:
 
 private:
   std::unique_ptr<zenoh::Session> impl_;
+  std::shared_ptr<zenoh::PosixShmProvider> shm_provider_;  // shared with publishers
+  std::size_t shm_min_message_size_{ 0 };
 };
 
 //-------------------------------------------------------------------------------------------------
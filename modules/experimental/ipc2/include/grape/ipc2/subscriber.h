@@ -19,6 +19,8 @@ namespace grape::ipc2 {
 class Session;
 
 //-------------------------------------------------------------------------------------------------
+/// Receives message payloads. The payload is usually passed in place, without copying, and is
+/// valid only for the duration of the call
 using DataCallback = std::function<void(std::span<const std::byte>)>;
 
 //=================================================================================================
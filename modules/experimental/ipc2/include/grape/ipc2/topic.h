@@ -4,13 +4,50 @@
 
 #pragma once
 
+#include <cstdint>
 #include <string>
 
 namespace grape::ipc2 {
 
+//=================================================================================================
+/// Quality of service settings for publishers
+struct PublisherQoS {
+  /// What a publisher does when messages cannot be sent as fast as they are published, such as
+  /// when a subscriber is slow
+  enum class CongestionControl : std::uint8_t {
+    Block,  //!< Wait until the message can be sent. Publishing may stall
+    Drop    //!< Discard the message. Publishing never stalls
+  };
+
+  /// Order in which messages are sent when several are pending, highest first
+  enum class Priority : std::uint8_t {
+    RealTime,
+    InteractiveHigh,
+    InteractiveLow,
+    DataHigh,
+    Data,
+    DataLow,
+    Background
+  };
+
+  enum class Reliability : std::uint8_t {
+    BestEffort,  //!< Messages may be lost in transport
+    Reliable     //!< Messages lost in transport are retransmitted
+  };
+
+  CongestionControl congestion_control{ CongestionControl::Block };
+  Priority priority{ Priority::Data };
+  Reliability reliability{ Reliability::BestEffort };
+
+  /// If set, each message is sent immediately. Otherwise, messages may be held back briefly and
+  /// batched with others, trading latency for throughput
+  bool is_express{ false };
+};
+
 //-------------------------------------------------------------------------------------------------
 struct Topic {
   std::string key;
+  PublisherQoS qos{};
 };
 
 }  // namespace grape::ipc2
@@ -8,6 +8,13 @@
 #include <unordered_map>
 #include <zenoh.hxx>
 
+// The shared-memory provider, ZShmMut, alloc_gc_defrag and payload slice iteration are only
+// available from zenoh-c built with ZENOHC_BUILD_WITH_SHARED_MEMORY and
+// ZENOHC_BUILD_WITH_UNSTABLE_API, whose targets then define these
+#if !defined(Z_FEATURE_SHARED_MEMORY) || !defined(Z_FEATURE_UNSTABLE_API)
+#error "ipc2 requires zenoh-c built with shared memory and unstable API support"
+#endif
+
 namespace grape::ipc2 {
 
 //-------------------------------------------------------------------------------------------------
@@ -4,14 +4,47 @@
 
 #include "grape/ipc2/publisher.h"
 
+#include <cstring>
+#include <utility>
+#include <variant>
+
 #include "ipc_zenoh.h"  // should be included before zenoh headers
 
 namespace grape::ipc2 {
+
+//-------------------------------------------------------------------------------------------------
+ShmBuffer::ShmBuffer(std::unique_ptr<zenoh::ZShmMut> zbuf) : impl_(std::move(zbuf)) {
+}
+
+//-------------------------------------------------------------------------------------------------
+ShmBuffer::~ShmBuffer() = default;
+
+//-------------------------------------------------------------------------------------------------
+ShmBuffer::ShmBuffer(ShmBuffer&&) noexcept = default;
+
+//-------------------------------------------------------------------------------------------------
+auto ShmBuffer::operator=(ShmBuffer&&) noexcept -> ShmBuffer& = default;
+
+//-------------------------------------------------------------------------------------------------
+auto ShmBuffer::data() -> std::span<std::byte> {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  return { reinterpret_cast<std::byte*>(impl_->data()), impl_->len() };
+}
+
 //-------------------------------------------------------------------------------------------------
 Publisher::~Publisher() = default;
 
 //-------------------------------------------------------------------------------------------------
 void Publisher::publish(std::span<const std::byte> bytes) {
+  if ((shm_provider_ != nullptr) && (bytes.size_bytes() >= shm_min_message_size_)) {
+    auto buffer = loan(bytes.size_bytes());
+    if (buffer.has_value()) {
+      std::memcpy(buffer->data().data(), bytes.data(), bytes.size_bytes());
+      publish(std::move(*buffer));
+      return;
+    }
+    // pool exhausted: fall back to the network transport
+  }
   const auto bytes_view = std::string_view(
       // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
       reinterpret_cast<const char*>(bytes.data()),  //
@@ -21,10 +54,34 @@ void Publisher::publish(std::span<const std::byte> bytes) {
 
 //-------------------------------------------------------------------------------------------------
 void Publisher::publish(std::span<const char> bytes) {
-  impl_->put(std::string_view{ bytes.data(), bytes.size() });
+  publish(std::as_bytes(bytes));
+}
+
+//-------------------------------------------------------------------------------------------------
+void Publisher::publish(ShmBuffer&& buffer) {
+  impl_->put(zenoh::Bytes(std::move(*buffer.impl_)));
+}
+
+//-------------------------------------------------------------------------------------------------
+auto Publisher::loan(std::size_t size) -> std::optional<ShmBuffer> {
+  if (shm_provider_ == nullptr) {
+    return std::nullopt;
+  }
+  // reclaim buffers released by subscribers and defragment the pool if needed, without blocking
+  auto result = shm_provider_->alloc_gc_defrag(size, zenoh::AllocAlignment({ 0 }));
+  auto* zbuf = std::get_if<zenoh::ZShmMut>(&result);
+  if (zbuf == nullptr) {
+    return std::nullopt;
+  }
+  return ShmBuffer(std::make_unique<zenoh::ZShmMut>(std::move(*zbuf)));
 }
 
 //-------------------------------------------------------------------------------------------------
-Publisher::Publisher(std::unique_ptr<zenoh::Publisher> zp) : impl_(std::move(zp)) {
+Publisher::Publisher(std::unique_ptr<zenoh::Publisher> zp,
+                     std::shared_ptr<zenoh::PosixShmProvider> shm_provider,
+                     std::size_t shm_min_message_size)
+  : impl_(std::move(zp))
+  , shm_provider_(std::move(shm_provider))
+  , shm_min_message_size_(shm_min_message_size) {
 }
 }  // namespace grape::ipc2
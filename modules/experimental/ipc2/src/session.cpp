@@ -4,6 +4,9 @@
 
 #include "grape/ipc2/session.h"
 
+#include <mutex>
+#include <utility>
+
 #include "grape/exception.h"
 #include "ipc_zenoh.h"  // should be included before zenoh headers
 
@@ -22,10 +25,12 @@ auto transform(const grape::ipc2::Session::Config& config) -> zenoh::Config {
   if (is_router_specified) {
     zconfig.insert_json5(Z_CONFIG_CONNECT_KEY, std::format(R"(["{}"])", toString(*config.router)));
   }
+  if (config.shared_memory.has_value()) {
+    zconfig.insert_json5("transport/shared_memory/enabled", "true");
+  }
   // TODO(vilas):
   //- enable timestamp (optional)
   //- enable cache history (optional)
-  //- enable shared memory (optional)
   // zconfig.insert_json5(Z_CONFIG_LISTEN_KEY, toString(config.listen_on));
   // todo: insert as ["tcp/[fe80::2145:12c5:9fc3:3c71]:7447", "tcp/192.168.0.2:7447"]
   return zconfig;
@@ -42,17 +47,98 @@ auto transform(const std::vector<zenoh::Id>& zids) -> std::vector<grape::ipc2::U
   return uuids;
 }
 
+//-------------------------------------------------------------------------------------------------
+auto toZenoh(grape::ipc2::PublisherQoS::CongestionControl cc) -> zenoh::CongestionControl {
+  using CongestionControl = grape::ipc2::PublisherQoS::CongestionControl;
+  switch (cc) {
+    case CongestionControl::Block:
+      return Z_CONGESTION_CONTROL_BLOCK;
+    case CongestionControl::Drop:
+      return Z_CONGESTION_CONTROL_DROP;
+  }
+  std::unreachable();
+}
+
+//-------------------------------------------------------------------------------------------------
+auto toZenoh(grape::ipc2::PublisherQoS::Priority priority) -> zenoh::Priority {
+  using Priority = grape::ipc2::PublisherQoS::Priority;
+  switch (priority) {
+    case Priority::RealTime:
+      return Z_PRIORITY_REAL_TIME;
+    case Priority::InteractiveHigh:
+      return Z_PRIORITY_INTERACTIVE_HIGH;
+    case Priority::InteractiveLow:
+      return Z_PRIORITY_INTERACTIVE_LOW;
+    case Priority::DataHigh:
+      return Z_PRIORITY_DATA_HIGH;
+    case Priority::Data:
+      return Z_PRIORITY_DATA;
+    case Priority::DataLow:
+      return Z_PRIORITY_DATA_LOW;
+    case Priority::Background:
+      return Z_PRIORITY_BACKGROUND;
+  }
+  std::unreachable();
+}
+
+//-------------------------------------------------------------------------------------------------
+auto toZenoh(grape::ipc2::PublisherQoS::Reliability reliability) -> zenoh::Reliability {
+  using Reliability = grape::ipc2::PublisherQoS::Reliability;
+  switch (reliability) {
+    case Reliability::BestEffort:
+      return Z_RELIABILITY_BEST_EFFORT;
+    case Reliability::Reliable:
+      return Z_RELIABILITY_RELIABLE;
+  }
+  std::unreachable();
+}
+
+//-------------------------------------------------------------------------------------------------
+// Buffer into which payloads that arrive in fragments are assembled, reused across messages
+struct LinearisationBuffer {
+  std::mutex mutex;
+  std::vector<std::byte> bytes;
+};
+
+//-------------------------------------------------------------------------------------------------
+auto toSpan(const zenoh::Slice& slice) -> std::span<const std::byte> {
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+  return { reinterpret_cast<const std::byte*>(slice.data), slice.len };
+}
+
 //-------------------------------------------------------------------------------------------------
 auto createDataCallback(grape::ipc2::DataCallback&& user_cb)
     -> std::function<void(const zenoh::Sample&)> {
   if (user_cb == nullptr) {
     return nullptr;
   }
-  return [cb = std::move(user_cb)](const zenoh::Sample& sample) -> void {
-    // TODO(vilas): Avoid copy. use SpliceIterator instead
-    const auto data = sample.get_payload().as_vector();
-    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
-    cb({ reinterpret_cast<const std::byte*>(data.data()), data.size() });
+  return [cb = std::move(user_cb), linear = std::make_shared<LinearisationBuffer>()](
+             const zenoh::Sample& sample) -> void {
+    // Payloads held in a single contiguous slice (including all shared-memory payloads) are
+    // passed on in place. Only fragmented payloads are copied, into a buffer that is reused.
+    // Slice iteration is part of zenoh-c's unstable API (see ipc_zenoh.h)
+    auto slices = sample.get_payload().slice_iter();
+    const auto first = slices.next();
+    if (not first.has_value()) {
+      cb({});
+      return;
+    }
+    auto next = slices.next();
+    if (not next.has_value()) {
+      cb(toSpan(*first));
+      return;
+    }
+    const auto lock = std::lock_guard(linear->mutex);
+    linear->bytes.clear();
+    const auto append = [&bytes = linear->bytes](std::span<const std::byte> fragment) {
+      bytes.insert(bytes.end(), fragment.begin(), fragment.end());
+    };
+    append(toSpan(*first));
+    while (next.has_value()) {
+      append(toSpan(*next));
+      next = slices.next();
+    }
+    cb(linear->bytes);
   };
 }
 }  // namespace
@@ -67,6 +153,15 @@ Session::Session(const Session::Config& config) {
   if (zerr != Z_OK) {
     grape::panic<Exception>(std::format("Failed to create session. Reason: {}", toString(zerr)));
   }
+  if (config.shared_memory.has_value()) {
+    shm_provider_ = std::make_shared<zenoh::PosixShmProvider>(
+        zenoh::MemoryLayout(config.shared_memory->pool_size, zenoh::AllocAlignment({ 0 })), &zerr);
+    if (zerr != Z_OK) {
+      grape::panic<Exception>(
+          std::format("Failed to create shared-memory provider. Reason: {}", toString(zerr)));
+    }
+    shm_min_message_size_ = config.shared_memory->min_message_size;
+  }
 }
 
 //-------------------------------------------------------------------------------------------------
@@ -89,16 +184,16 @@ auto Session::peers() const -> std::vector<UUID> {
 
 //-------------------------------------------------------------------------------------------------
 auto Session::createPublisher(const Topic& topic) -> Publisher {
-  /// @todo(vilas) Review all the following settings. Expose critical ones
   auto options = zenoh::Session::PublisherOptions::create_default();
-  options.congestion_control = Z_CONGESTION_CONTROL_BLOCK;
-  options.priority = Z_PRIORITY_DATA;
-  options.is_express = false;
-  options.reliability = Z_RELIABILITY_BEST_EFFORT;
+  options.congestion_control = toZenoh(topic.qos.congestion_control);
+  options.priority = toZenoh(topic.qos.priority);
+  options.is_express = topic.qos.is_express;
+  options.reliability = toZenoh(topic.qos.reliability);
   auto zerr = zenoh::ZResult{};
 
   auto pub = Publisher(std::make_unique<zenoh::Publisher>(
-      impl_->declare_publisher(topic.key, std::move(options), &zerr)));
+                           impl_->declare_publisher(topic.key, std::move(options), &zerr)),
+                       shm_provider_, shm_min_message_size_);
   if (zerr != Z_OK) {
     grape::panic<Exception>(std::format("Failed to create publisher. Reason: {}", toString(zerr)));
   }